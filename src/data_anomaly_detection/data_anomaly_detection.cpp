@@ -23,25 +23,48 @@
 
 // stdc++ headers
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <iterator>
 #include <list>
+#include <memory>
+#include <numeric>
 
 // project headers
 #include "data_structure/acceleration.h"
-#include "numerical_algorithm/vector_calculation.h"
+#include "data_structure/acceleration_view.h"
+#include "data_structure/column_matrix.h"
 
 namespace data_anomaly_detection
 {
-// 从加速度信息构造
+
+namespace
+{
+
+// 两列信号的内积，即0偏移的互相关值
+// @param col_x 信号x
+// @param col_y 信号y
+// @return 内积
+double InnerProduct(data_structure::ConstColumnView col_x,
+                    data_structure::ConstColumnView col_y)
+{
+    auto size = std::min(col_x.size(), col_y.size());
+    return std::inner_product(
+        col_x.begin(), col_x.begin() + size, col_y.begin(), 0.0);
+}
+
+} // namespace
+
+// 从加速度信息或加速度视图构造
 DataAnomalyDetection::DataAnomalyDetection(
-    const data_structure::Acceleration &acceleration_data,
+    const data_structure::AccelerationView &acceleration_data,
     int channel_num)
-    : channel_num_(channel_num), result_(channel_num)
+    : acceleration_view_(acceleration_data), result_(channel_num),
+      channel_num_(channel_num)
 {
-    for (std::size_t i = 0; i < acceleration_data.get_col_number(); ++i)
+    for (std::size_t i = 0; i < acceleration_view_.get_col_number(); ++i)
     {
-        acceleration_data_[i] = acceleration_data.get_col(i);
+        acceleration_data_[i] = acceleration_view_[i];
     }
 }
 
@@ -49,25 +72,21 @@ DataAnomalyDetection::DataAnomalyDetection(
 DataAnomalyDetection::DataAnomalyDetection(
     const std::shared_ptr<data_structure::Acceleration> &acceleration_data_ptr,
     int channel_num)
-    : channel_num_(channel_num), result_(channel_num)
-{
-    for (std::size_t i = 0; i < acceleration_data_ptr->get_col_number(); ++i)
-    {
-        acceleration_data_[i] = acceleration_data_ptr->get_col(i);
-    }
-}
+    : DataAnomalyDetection(
+          data_structure::AccelerationView(*acceleration_data_ptr), channel_num)
+{}
 
 // 从vector<vector<double>>构造
 DataAnomalyDetection::DataAnomalyDetection(
     const std::vector<std::vector<double>> &acceleration_data,
     int channel_num)
-    : channel_num_(channel_num), result_(channel_num)
-{
-    for (std::size_t i = 0; i < acceleration_data.size(); ++i)
-    {
-        acceleration_data_[i] = acceleration_data[i];
-    }
-}
+    : DataAnomalyDetection(
+          data_structure::AccelerationView(
+              std::make_shared<const data_structure::ColumnMatrix>(
+                  acceleration_data),
+              0.0),
+          channel_num)
+{}
 
 // 处理数据异常问题
 std::vector<std::vector<int>> DataAnomalyDetection::ProcessDataAnomaly()
@@ -82,8 +101,7 @@ std::vector<std::vector<int>> DataAnomalyDetection::ProcessDataAnomaly()
     std::list<double> energy;
     for (const auto &data : acceleration_data_)
     {
-        energy.push_back(numerical_algorithm::CrossCorrelationAtShift(
-            data.second, data.second, 0));
+        energy.push_back(InnerProduct(data.second, data.second));
     }
     std::size_t measure_num = energy.size() / channel_num_;
 
@@ -107,8 +125,9 @@ std::vector<std::vector<int>> DataAnomalyDetection::ProcessDataAnomaly()
             for (const auto &data : acceleration_data_)
             {
                 cross_correlation.push_back(
-                    numerical_algorithm::CrossCorrelationAtShiftNormalized(
-                        lower_data, data.second, 0));
+                    InnerProduct(lower_data, data.second)
+                    / std::sqrt(InnerProduct(lower_data, lower_data)
+                                * InnerProduct(data.second, data.second)));
             }
             // 3.2.2寻找最大值作为方向
             auto max_iter = std::max_element(cross_correlation.begin(),
@@ -29,7 +29,9 @@
 
 // project headers
 #include "data_structure/acceleration.h"
+#include "data_structure/acceleration_view.h"
 #include "data_structure/basic_data_structure.h"
+#include "data_structure/column_matrix.h"
 
 namespace data_anomaly_detection
 {
@@ -39,10 +41,11 @@ public:
     // 默认构造函数
     DataAnomalyDetection() = default;
 
-    // 从加速度信息构造
+    // 从加速度信息或加速度视图构造，不复制加速度数据
     // @param acceleration_data 加速度信息
-    DataAnomalyDetection(const data_structure::Acceleration &acceleration_data,
-                         int channel_num = 3);
+    DataAnomalyDetection(
+        const data_structure::AccelerationView &acceleration_data,
+        int channel_num = 3);
 
     // 从加速度信息指针构造
     // @param acceleration_data_ptr 加速度信息指针
@@ -62,8 +65,11 @@ public:
     std::vector<std::vector<int>> ProcessDataAnomaly();
 
 private:
-    // 加速度信息
-    std::map<int, std::vector<double>> acceleration_data_;
+    // 加速度视图，持有共享的加速度数据
+    data_structure::AccelerationView acceleration_view_{};
+
+    // 各列加速度的视图
+    std::map<int, data_structure::ConstColumnView> acceleration_data_;
 
     std::vector<std::vector<int>> result_;
 
@@ -22,8 +22,13 @@
 #include "acceleration.h"
 
 // stdc++ headers
+#include <algorithm>
+#include <stdexcept>
 #include <vector>
 
+// project headers
+#include "acceleration_view.h"
+
 
 namespace data_structure
 {
@@ -36,12 +41,16 @@ Acceleration::Acceleration(const Acceleration &acceleration,
     : frequency_(frequency)
 {
     resize(acceleration.get_row_number(), col_index.size());
-    std::size_t i = 0;
-    for (auto index : col_index)
-    {
-        data_->at(i) = acceleration.data_->at(index);
-        ++i;
-    }
+    // 单精度存储的加速度在复制时转换为double
+    acceleration.Visit([&](const auto &matrix) {
+        std::size_t i = 0;
+        for (auto index : col_index)
+        {
+            auto col = matrix.at(index);
+            std::copy(col.begin(), col.end(), (*data_)[i].begin());
+            ++i;
+        }
+    });
     adjust_acceleration(scale);
 }
 
@@ -57,37 +66,43 @@ Acceleration::Acceleration(
     std::size_t i = 0;
     for (auto index : col_index)
     {
-        data_->at(i) = acceleration_vector.at(index);
+        const auto &col = acceleration_vector.at(index);
+        if (col.size() != get_row_number())
+            throw std::invalid_argument(
+                "All columns of the matrix must have the same length.");
+        std::copy(col.begin(), col.end(), (*data_)[i].begin());
         ++i;
     }
     adjust_acceleration(scale);
 }
 
-// 求解楼层相对底层的加速度
-Acceleration Acceleration::relative_acceleration() const
+// 从加速度视图构造
+Acceleration::Acceleration(const AccelerationView &view)
+    : frequency_(view.get_frequency())
 {
-    Acceleration result(data_->front().size(), data_->size() - 1, frequency_);
-    for (std::size_t i = 0; i < result.data_->size(); ++i)
+    resize(view.get_row_number(), view.get_col_number());
+    for (std::size_t i = 0; i < view.get_col_number(); ++i)
     {
-        for (std::size_t j = 0; j < result.data_->at(i).size(); ++j)
-        {
-            result.data_->at(i)[j] = data_->at(i + 1)[j] - data_->at(0)[j];
-        }
+        auto col = view[i];
+        std::copy(col.begin(), col.end(), (*data_)[i].begin());
     }
+}
+
+// 求解楼层相对底层的加速度
+Acceleration Acceleration::relative_acceleration() const
+{
+    Acceleration result;
+    result.frequency_ = frequency_;
+    ColumnDifference(result, true);
     return result;
 }
 
 // 求解层间相对加速度
 Acceleration Acceleration::interstory_acceleration() const
 {
-    Acceleration result(data_->front().size(), data_->size() - 1, frequency_);
-    for (std::size_t i = 0; i < result.data_->size(); ++i)
-    {
-        for (std::size_t j = 0; j < result.data_->at(i).size(); ++j)
-        {
-            result.data_->at(i)[j] = data_->at(i + 1)[j] - data_->at(i)[j];
-        }
-    }
+    Acceleration result;
+    result.frequency_ = frequency_;
+    ColumnDifference(result, false);
     return result;
 }
 
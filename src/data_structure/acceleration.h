@@ -28,7 +28,9 @@
 #include <algorithm>
 #include <initializer_list>
 #include <iosfwd>
+#include <memory>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 // project headers
@@ -37,6 +39,9 @@
 
 namespace data_structure
 {
+
+class AccelerationView;
+
 // 加速度信息类
 class Acceleration : public BasicData
 {
@@ -69,6 +74,27 @@ public:
         adjust_acceleration(scale);
     }
 
+    // 从连续存储的矩阵构造，每列代表一个测点的加速度数据
+    // @param matrix 加速度数据矩阵
+    // @param frequency 采样频率
+    // @param scale 调幅因子
+    Acceleration(ColumnMatrix matrix,
+                 const double &frequency,
+                 const double &scale = 1.0)
+        : BasicData(std::move(matrix)), frequency_(frequency)
+    {
+        adjust_acceleration(scale);
+    }
+
+    // 共享连续存储的矩阵构造，不复制数据，也不调整均值和调幅（用于读取已处理
+    // 过的数据，如二进制记录）
+    // @param matrix_ptr 加速度数据矩阵指针
+    // @param frequency 采样频率
+    Acceleration(std::shared_ptr<ColumnMatrix> matrix_ptr,
+                 const double &frequency)
+        : BasicData(std::move(matrix_ptr)), frequency_(frequency)
+    {}
+
     // 从输入流构造，col_number为测点数量，row_number为每个测点的数据长度
     // @param stream 输入流
     // @param row_number 每个测点的数据长度
@@ -105,6 +131,10 @@ public:
                  const double &frequency,
                  const double &scale = 1.0);
 
+    // 从加速度视图构造，复制视图选择的数据，不再调整均值和调幅
+    // @param view 加速度视图
+    explicit Acceleration(const AccelerationView &view);
+
     // 析构函数
     ~Acceleration() = default;
 
@@ -131,16 +161,16 @@ private:
     // 调整输入加速度使其各列均值为0，并作调幅处理
     inline void adjust_acceleration(const double &scale)
     {
-        for (std::size_t i = 0; i < data_->size(); ++i)
+        for (std::size_t i = 0; i < data_->get_col_number(); ++i)
         {
+            auto col = (*data_)[i];
             const double col_mean =
-                std::accumulate(data_->at(i).begin(), data_->at(i).end(), 0.0)
-                / data_->at(i).size();
+                std::accumulate(col.begin(), col.end(), 0.0) / col.size();
             // 如果事先介入了数据异常处理模块，则一般可以保证所有信号的均值为0
             // const double col_mean = 0;
-            std::transform(data_->at(i).begin(),
-                           data_->at(i).end(),
-                           data_->at(i).begin(),
+            std::transform(col.begin(),
+                           col.end(),
+                           col.begin(),
                            [col_mean, scale](const double &val) {
                                return (val - col_mean) * scale;
                            });
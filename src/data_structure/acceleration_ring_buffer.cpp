@@ -0,0 +1,157 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\acceleration_ring_buffer.cpp
+** -----
+** File Created: Saturday, 17th October 2026 16:48:05
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 16:48:05
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 加速度环形缓冲区的实现
+
+// associated header
+#include "acceleration_ring_buffer.h"
+
+// stdc++ headers
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace data_structure
+{
+
+// 由通道数、容量和采样频率构造
+AccelerationRingBuffer::AccelerationRingBuffer(std::size_t channel_number,
+                                               std::size_t capacity,
+                                               double frequency)
+    : channel_number_(channel_number), capacity_(capacity),
+      frequency_(frequency)
+{
+    if (channel_number == 0 || capacity == 0)
+        throw std::invalid_argument(
+            "The channel number and capacity must be positive.");
+    storage_ =
+        std::make_unique<std::atomic<double>[]>(channel_number * capacity);
+}
+
+// 写入一块样本
+void AccelerationRingBuffer::Push(const double *samples,
+                                  std::size_t sample_number)
+{
+    auto count = write_count_.load(std::memory_order_relaxed);
+    const auto end = count + sample_number;
+    // 超过容量的部分会被本块自己覆盖，直接跳过，但仍计入样本总数
+    if (sample_number > capacity_)
+    {
+        samples += (sample_number - capacity_) * channel_number_;
+        count += sample_number - capacity_;
+        sample_number = capacity_;
+    }
+
+    // 1.先公布将要覆盖的范围，读取方据此判断拷贝是否失效。release栅栏保证
+    //   读取方读到之后写入的样本时，也能读到这里公布的范围
+    reserve_count_.store(end, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // 2.按通道连续写入
+    for (std::size_t j = 0; j < channel_number_; ++j)
+    {
+        auto col = storage_.get() + j * capacity_;
+        auto row = static_cast<std::size_t>(count % capacity_);
+        for (std::size_t i = 0; i < sample_number; ++i)
+        {
+            col[row].store(samples[i * channel_number_ + j],
+                           std::memory_order_relaxed);
+            row = row + 1 == capacity_ ? 0 : row + 1;
+        }
+    }
+
+    // 3.写入完成后公布新的样本总数
+    write_count_.store(end, std::memory_order_release);
+}
+
+// 写入一块样本
+void AccelerationRingBuffer::Push(const std::vector<double> &samples)
+{
+    if (samples.size() % channel_number_ != 0)
+        throw std::invalid_argument(
+            "The sample size must be a multiple of the channel number.");
+    Push(samples.data(), samples.size() / channel_number_);
+}
+
+// 复制指定范围的样本
+ColumnMatrix AccelerationRingBuffer::Copy(std::uint64_t first_sample,
+                                          std::uint64_t end_sample) const
+{
+    auto sample_number = static_cast<std::size_t>(end_sample - first_sample);
+    ColumnMatrix matrix(sample_number, channel_number_);
+    for (std::size_t j = 0; j < channel_number_; ++j)
+    {
+        auto source = storage_.get() + j * capacity_;
+        auto col = matrix[j];
+        auto row = static_cast<std::size_t>(first_sample % capacity_);
+        for (std::size_t i = 0; i < sample_number; ++i)
+        {
+            col[i] = source[row].load(std::memory_order_relaxed);
+            row = row + 1 == capacity_ ? 0 : row + 1;
+        }
+    }
+    return matrix;
+}
+
+// 复制最新数据
+RingBufferSnapshot
+AccelerationRingBuffer::Snapshot(std::size_t sample_number) const
+{
+    while (true)
+    {
+        RingBufferSnapshot snapshot;
+        snapshot.end_sample_ = write_count_.load(std::memory_order_acquire);
+        auto available = static_cast<std::size_t>(
+            std::min<std::uint64_t>(snapshot.end_sample_, capacity_));
+        auto number = std::min(sample_number, available);
+        snapshot.first_sample_ = snapshot.end_sample_ - number;
+        auto matrix = Copy(snapshot.first_sample_, snapshot.end_sample_);
+
+        // 第k个样本在写入第k + capacity个样本时被覆盖；acquire栅栏保证复制时
+        // 读到的样本若已被覆盖，这里读到的预留总数也已越过它
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (reserve_count_.load(std::memory_order_relaxed)
+            <= snapshot.first_sample_ + capacity_)
+        {
+            snapshot.acceleration_ = Acceleration(
+                std::make_shared<ColumnMatrix>(std::move(matrix)), frequency_);
+            return snapshot;
+        }
+    }
+}
+
+// 复制最新若干秒的数据
+RingBufferSnapshot AccelerationRingBuffer::SnapshotSeconds(double seconds) const
+{
+    return Snapshot(
+        static_cast<std::size_t>(std::llround(seconds * frequency_)));
+}
+
+// 复制最新数据
+Acceleration AccelerationRingBuffer::CopyLatest(std::size_t sample_number) const
+{
+    return Snapshot(sample_number).acceleration_;
+}
+
+} // namespace data_structure
@@ -0,0 +1,129 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\acceleration_ring_buffer.h
+** -----
+** File Created: Saturday, 17th October 2026 16:48:05
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 16:48:05
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 连续监测用的加速度环形缓冲区，一个采集线程写入，多个分析线程读取，均不加锁。
+// 样本存储为std::atomic<double>，写入和读取都是relaxed的原子操作，由seqlock的
+// 计数和内存栅栏确定先后：写入方先公布将要覆盖的范围再写入，读取方复制最新的
+// 数据后检查复制期间数据是否被覆盖，被覆盖时重新复制。写入不等待读取，读取方
+// 得到的是一致的拷贝。
+
+#ifndef DATA_STRUCTURE_ACCELERATION_RING_BUFFER_H_
+#define DATA_STRUCTURE_ACCELERATION_RING_BUFFER_H_
+
+// stdc++ headers
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// project headers
+#include "acceleration.h"
+
+
+namespace data_structure
+{
+
+// 环形缓冲区的快照
+struct RingBufferSnapshot
+{
+    // 最新数据的拷贝，行为时刻，列为通道
+    Acceleration acceleration_{};
+    // 快照中第一个样本和最后一个样本之后的全局序号（自开始写入起计数）
+    std::uint64_t first_sample_{}, end_sample_{};
+};
+
+// 加速度环形缓冲区类
+class AccelerationRingBuffer
+{
+public:
+    // 由通道数、容量和采样频率构造
+    // @param channel_number 通道（测点）数
+    // @param capacity 每个通道保留的样本数，快照的长度不超过容量；容量比分析
+    //        窗口长的部分减少复制期间数据被覆盖而重试的次数
+    // @param frequency 采样频率
+    AccelerationRingBuffer(std::size_t channel_number,
+                           std::size_t capacity,
+                           double frequency);
+
+    // 禁止拷贝
+    AccelerationRingBuffer(const AccelerationRingBuffer &) = delete;
+    AccelerationRingBuffer &operator=(const AccelerationRingBuffer &) = delete;
+
+    // 析构函数
+    ~AccelerationRingBuffer() = default;
+
+    // 写入一块样本，只能由一个线程调用，不等待读取方
+    // @param samples 按通道交错存储的样本，第i个时刻第j个通道位于
+    //        [i * 通道数 + j]
+    // @param sample_number 时刻数，超过容量时只保留最后的容量个时刻，跳过的
+    //        时刻仍计入样本总数
+    void Push(const double *samples, std::size_t sample_number);
+
+    // 写入一块样本，只能由一个线程调用
+    // @param samples 按通道交错存储的样本，长度须为通道数的整数倍
+    void Push(const std::vector<double> &samples);
+
+    // 复制最新数据，数据在复制期间被覆盖时重试，得到的数据一定一致
+    // @param sample_number 快照的时刻数，超过已写入的样本数或容量时取较小值
+    // @return 快照
+    RingBufferSnapshot Snapshot(std::size_t sample_number) const;
+
+    // 复制最新若干秒的数据
+    // @param seconds 时长（秒）
+    // @return 快照
+    RingBufferSnapshot SnapshotSeconds(double seconds) const;
+
+    // 复制最新数据，只返回加速度数据
+    // @param sample_number 时刻数
+    // @return 加速度数据的拷贝
+    Acceleration CopyLatest(std::size_t sample_number) const;
+
+    // 获取已写入的样本总数
+    std::uint64_t get_write_count() const
+    {
+        return write_count_.load(std::memory_order_acquire);
+    }
+
+    // 获取通道数
+    std::size_t get_channel_number() const { return channel_number_; }
+    // 获取容量
+    std::size_t get_capacity() const { return capacity_; }
+    // 获取采样频率
+    double get_frequency() const { return frequency_; }
+
+private:
+    // 通道数、容量和采样频率
+    std::size_t channel_number_{}, capacity_{};
+    double frequency_{};
+    // 按通道连续的存储，第j个通道的第k个样本位于[j * capacity + k % capacity]
+    std::unique_ptr<std::atomic<double>[]> storage_{};
+    // 开始写入时预留的样本总数和写入完成的样本总数
+    std::atomic<std::uint64_t> reserve_count_{0}, write_count_{0};
+
+    // 复制[first_sample, end_sample)的样本，不检查是否被覆盖
+    // @param first_sample 第一个样本的全局序号
+    // @param end_sample 最后一个样本之后的全局序号
+    // @return 数据矩阵，行为时刻，列为通道
+    ColumnMatrix Copy(std::uint64_t first_sample,
+                      std::uint64_t end_sample) const;
+};
+
+} // namespace data_structure
+
+#endif // DATA_STRUCTURE_ACCELERATION_RING_BUFFER_H_
@@ -0,0 +1,150 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\acceleration_view.cpp
+** -----
+** File Created: Saturday, 17th October 2026 09:12:30
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 09:12:30
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 加速度视图类的实现。
+
+// associated header
+#include "acceleration_view.h"
+
+// stdc++ headers
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace data_structure
+{
+
+namespace
+{
+
+// 获取加速度数据的双精度矩阵，单精度存储时转换为一份double拷贝，保证后续的
+// 积分和滤波在double下计算
+// @param acceleration 加速度数据
+// @return 共享的双精度矩阵
+std::shared_ptr<const ColumnMatrix>
+DoubleMatrixPtr(const Acceleration &acceleration)
+{
+    if (acceleration.get_precision() == StoragePrecision::float32)
+    {
+        return std::make_shared<const ColumnMatrix>(
+            acceleration.get_float_matrix());
+    }
+    return acceleration.get_matrix_ptr();
+}
+
+} // namespace
+
+// 整个加速度数据的视图
+AccelerationView::AccelerationView(const Acceleration &acceleration)
+    : AccelerationView(DoubleMatrixPtr(acceleration),
+                       acceleration.get_frequency())
+{}
+
+// 加速度数据指定列和时间范围的视图
+AccelerationView::AccelerationView(const Acceleration &acceleration,
+                                   const std::vector<std::size_t> &col_index,
+                                   std::size_t row_begin,
+                                   std::size_t row_end)
+    : data_(DoubleMatrixPtr(acceleration)), col_index_(col_index),
+      row_begin_(row_begin), frequency_(acceleration.get_frequency())
+{
+    SetRange(row_end);
+}
+
+// 共享矩阵的视图
+AccelerationView::AccelerationView(
+    std::shared_ptr<const ColumnMatrix> matrix_ptr,
+    double frequency)
+    : data_(std::move(matrix_ptr)), col_index_(data_->get_col_number()),
+      frequency_(frequency)
+{
+    std::iota(col_index_.begin(), col_index_.end(), std::size_t(0));
+    SetRange(npos);
+}
+
+// 在当前视图上继续选择列
+AccelerationView
+AccelerationView::Select(const std::vector<std::size_t> &col_index) const
+{
+    AccelerationView view(*this);
+    view.col_index_.resize(col_index.size());
+    for (std::size_t j = 0; j < col_index.size(); ++j)
+    {
+        if (col_index[j] >= col_index_.size())
+            throw std::out_of_range("Column index out of range.");
+        view.col_index_[j] = col_index_[col_index[j]];
+    }
+    return view;
+}
+
+// 在当前视图上继续选择时间范围
+AccelerationView AccelerationView::Slice(std::size_t row_begin,
+                                         std::size_t row_end) const
+{
+    if (row_end == npos)
+    {
+        row_end = row_number_;
+    }
+    if (row_begin > row_end || row_end > row_number_)
+        throw std::out_of_range("Row range out of range.");
+    AccelerationView view(*this);
+    view.row_begin_ = row_begin_ + row_begin;
+    view.row_number_ = row_end - row_begin;
+    return view;
+}
+
+// 获取指定列的视图，检查索引
+ConstColumnView AccelerationView::col(std::size_t col_index) const
+{
+    if (col_index >= col_index_.size())
+        throw std::out_of_range("Column index out of range.");
+    return (*this)[col_index];
+}
+
+// 获取数据矩阵的拷贝
+std::vector<std::vector<double>> AccelerationView::get_data() const
+{
+    std::vector<std::vector<double>> matrix(col_index_.size());
+    for (std::size_t j = 0; j < col_index_.size(); ++j)
+    {
+        matrix[j] = (*this)[j].to_vector();
+    }
+    return matrix;
+}
+
+// 检查列索引和时间范围并确定行数
+void AccelerationView::SetRange(std::size_t row_end)
+{
+    for (auto index : col_index_)
+    {
+        if (index >= data_->get_col_number())
+            throw std::out_of_range("Column index out of range.");
+    }
+    if (row_end == npos)
+    {
+        row_end = data_->get_row_number();
+    }
+    if (row_begin_ > row_end || row_end > data_->get_row_number())
+        throw std::out_of_range("Row range out of range.");
+    row_number_ = row_end - row_begin_;
+}
+
+} // namespace data_structure
@@ -0,0 +1,151 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\acceleration_view.h
+** -----
+** File Created: Saturday, 17th October 2026 09:12:30
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 09:12:30
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 加速度视图类，按索引选择加速度数据的部分列（测点）和连续的时间范围，
+// 不复制数据。视图与加速度数据共享存储，通过加速度数据修改的值在视图中可见；
+// 源数据改变大小后，视图的索引可能越界，需要重新创建视图。单精度存储的加速度
+// 数据在创建视图时转换为一份double拷贝，此时视图不与加速度数据共享存储。
+
+#ifndef DATA_STRUCTURE_ACCELERATION_VIEW_H_
+#define DATA_STRUCTURE_ACCELERATION_VIEW_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+// project headers
+#include "acceleration.h"
+#include "column_matrix.h"
+
+
+namespace data_structure
+{
+
+// 加速度视图类
+class AccelerationView
+{
+public:
+    // 表示时间范围到数据末尾
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    // 默认构造函数，空视图
+    AccelerationView() = default;
+
+    // 整个加速度数据的视图，可由加速度数据隐式转换
+    // @param acceleration 加速度数据
+    AccelerationView(const Acceleration &acceleration);
+
+    // 加速度数据指定列和时间范围的视图
+    // @param acceleration 加速度数据
+    // @param col_index 选择的列索引，可以重复或改变顺序
+    // @param row_begin 起始行（时刻）索引
+    // @param row_end 结束行索引（不含），npos表示到数据末尾
+    AccelerationView(const Acceleration &acceleration,
+                     const std::vector<std::size_t> &col_index,
+                     std::size_t row_begin = 0,
+                     std::size_t row_end = npos);
+
+    // 共享矩阵的视图，包含全部列和全部时刻
+    // @param matrix_ptr 数据矩阵指针
+    // @param frequency 采样频率
+    AccelerationView(std::shared_ptr<const ColumnMatrix> matrix_ptr,
+                     double frequency);
+
+    // 析构函数
+    ~AccelerationView() = default;
+
+    // 在当前视图上继续选择列
+    // @param col_index 相对于当前视图的列索引
+    // @return 新的视图
+    AccelerationView Select(const std::vector<std::size_t> &col_index) const;
+
+    // 在当前视图上继续选择时间范围
+    // @param row_begin 相对于当前视图的起始行索引
+    // @param row_end 相对于当前视图的结束行索引（不含），npos表示到末尾
+    // @return 新的视图
+    AccelerationView Slice(std::size_t row_begin,
+                           std::size_t row_end = npos) const;
+
+    // 获取行数
+    std::size_t get_row_number() const { return row_number_; }
+    // 获取列数
+    std::size_t get_col_number() const { return col_index_.size(); }
+
+    // 获取采样频率
+    double get_frequency() const { return frequency_; }
+    // 获取时间步长
+    double get_time_step() const { return 1.0 / frequency_; }
+
+    // 获取各列在源数据中的列索引
+    const std::vector<std::size_t> &get_col_index() const
+    {
+        return col_index_;
+    }
+    // 获取起始行在源数据中的索引
+    std::size_t get_row_begin() const { return row_begin_; }
+
+    // 获取指定列的视图，不检查索引
+    // @param col_index 列索引
+    ConstColumnView operator[](std::size_t col_index) const
+    {
+        return {(*data_)[col_index_[col_index]].data() + row_begin_,
+                row_number_};
+    }
+
+    // 获取指定列的视图，索引越界时抛出std::out_of_range
+    // @param col_index 列索引
+    ConstColumnView col(std::size_t col_index) const;
+
+    // 获取指定行列的元素，不检查索引
+    // @param row_index 行索引
+    // @param col_index 列索引
+    double operator()(std::size_t row_index, std::size_t col_index) const
+    {
+        return (*data_)(row_begin_ + row_index, col_index_[col_index]);
+    }
+
+    // 获取指定列数据的拷贝
+    // @param col_index 列索引
+    std::vector<double> get_col(std::size_t col_index) const
+    {
+        return col(col_index).to_vector();
+    }
+
+    // 获取数据矩阵的拷贝
+    std::vector<std::vector<double>> get_data() const;
+
+private:
+    // 共享的数据矩阵
+    std::shared_ptr<const ColumnMatrix> data_ =
+        std::make_shared<const ColumnMatrix>();
+    // 各列在源数据中的列索引
+    std::vector<std::size_t> col_index_{};
+    // 起始行索引和行数
+    std::size_t row_begin_{0}, row_number_{0};
+    // 采样频率
+    double frequency_{};
+
+    // 检查列索引和时间范围并确定行数
+    // @param row_end 结束行索引（不含），npos表示到数据末尾
+    void SetRange(std::size_t row_end);
+};
+
+} // namespace data_structure
+
+#endif // DATA_STRUCTURE_ACCELERATION_VIEW_H_
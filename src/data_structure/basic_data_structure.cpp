@@ -22,17 +22,158 @@
 #include "basic_data_structure.h"
 
 // stdc++ headers
+#include <algorithm>
+#include <cmath>
 #include <iosfwd>
 #include <iostream>
+#include <memory>
+#include <numeric>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 // project headers
-#include "numerical_algorithm/vector_calculation.h"
+#include "matrix_expression.h"
+#include "numerical_algorithm/parallel.h"
+#include "text_matrix_reader.h"
 
 
 namespace data_structure
 {
 
+namespace
+{
+
+// 统计量按块计算，块内的极值、和与平方和分成多个独立的通道累加，便于向量化
+constexpr std::size_t kStatisticsBlockSize = 512;
+constexpr std::size_t kStatisticsLaneNumber = 8;
+
+// 一次遍历计算单列信号的统计量，单精度数据同样在double下累加
+// @param data 信号数据
+// @param size 信号长度
+// @return 统计量
+template <typename T>
+ColumnStatistics ComputeStatistics(const T *data, std::size_t size)
+{
+    ColumnStatistics statistics;
+    if (size == 0)
+    {
+        return statistics;
+    }
+    statistics.max_ = statistics.min_ = statistics.abs_max_ = data[0];
+    double abs_max = std::abs(data[0]);
+    double sum = 0.0, energy = 0.0;
+    std::size_t zero_crossing = 0;
+
+    constexpr auto kLane = kStatisticsLaneNumber;
+    for (std::size_t begin = 0; begin < size; begin += kStatisticsBlockSize)
+    {
+        auto n = std::min(kStatisticsBlockSize, size - begin);
+        const T *x = data + begin;
+
+        // 1.块内分通道求极值、和与平方和
+        double lane_max[kLane], lane_min[kLane], lane_abs[kLane];
+        double lane_sum[kLane], lane_energy[kLane];
+        for (std::size_t l = 0; l < kLane; ++l)
+        {
+            lane_max[l] = lane_min[l] = x[0];
+            lane_abs[l] = std::abs(x[0]);
+            lane_sum[l] = lane_energy[l] = 0.0;
+        }
+        std::size_t i = 0;
+        for (; i + kLane <= n; i += kLane)
+        {
+            for (std::size_t l = 0; l < kLane; ++l)
+            {
+                double value = x[i + l];
+                lane_max[l] = value > lane_max[l] ? value : lane_max[l];
+                lane_min[l] = value < lane_min[l] ? value : lane_min[l];
+                double abs_value = std::abs(value);
+                lane_abs[l] = abs_value > lane_abs[l] ? abs_value : lane_abs[l];
+                lane_sum[l] += value;
+                lane_energy[l] += value * value;
+            }
+        }
+        for (; i < n; ++i)
+        {
+            double value = x[i];
+            lane_max[0] = std::max(lane_max[0], value);
+            lane_min[0] = std::min(lane_min[0], value);
+            lane_abs[0] = std::max(lane_abs[0], std::abs(value));
+            lane_sum[0] += value;
+            lane_energy[0] += value * value;
+        }
+        double block_max = lane_max[0], block_min = lane_min[0],
+               block_abs = lane_abs[0];
+        for (std::size_t l = 0; l < kLane; ++l)
+        {
+            block_max = std::max(block_max, lane_max[l]);
+            block_min = std::min(block_min, lane_min[l]);
+            block_abs = std::max(block_abs, lane_abs[l]);
+            sum += lane_sum[l];
+            energy += lane_energy[l];
+        }
+
+        // 2.过零次数，包括与上一块最后一点之间的过零
+        for (std::size_t k = std::max<std::size_t>(begin, 1); k < begin + n;
+             ++k)
+        {
+            zero_crossing +=
+                static_cast<double>(data[k - 1]) * data[k] < 0.0;
+        }
+
+        // 3.块内极值超过已有极值时，在块内（位于缓存中）查找其第一次出现的位置
+        if (begin == 0 || block_max > statistics.max_)
+        {
+            statistics.max_ = block_max;
+            statistics.max_index_ = std::find(x, x + n, block_max) - data;
+        }
+        if (begin == 0 || block_min < statistics.min_)
+        {
+            statistics.min_ = block_min;
+            statistics.min_index_ = std::find(x, x + n, block_min) - data;
+        }
+        if (begin == 0 || block_abs > abs_max)
+        {
+            abs_max = block_abs;
+            statistics.abs_max_index_ =
+                std::find_if(x,
+                             x + n,
+                             [block_abs](T value) {
+                                 return std::abs(static_cast<double>(value))
+                                        == block_abs;
+                             })
+                - data;
+            statistics.abs_max_ = data[statistics.abs_max_index_];
+        }
+    }
+
+    statistics.energy_ = energy;
+    statistics.mean_ = sum / size;
+    statistics.rms_ = std::sqrt(energy / size);
+    statistics.zero_crossing_ = zero_crossing;
+    return statistics;
+}
+
+// 复制为二维std::vector<std::vector<double>>
+// @param matrix 数据矩阵
+// @return 数据矩阵的拷贝
+template <typename T>
+std::vector<std::vector<double>>
+ToDoubleVector(const BasicColumnMatrix<T> &matrix)
+{
+    std::vector<std::vector<double>> result(matrix.get_col_number());
+    for (std::size_t j = 0; j < result.size(); ++j)
+    {
+        auto col = matrix[j];
+        result[j].assign(col.begin(), col.end());
+    }
+    return result;
+}
+
+} // namespace
+
 // 从输入流构造
 BasicData::BasicData(std::istream &stream,
                      std::size_t row_number,
@@ -65,13 +206,8 @@ BasicData::BasicData(std::istream &stream,
         std::cerr << e.what() << std::endl;
     }
     resize(row_number, col_number);
-    for (std::size_t i = 0; i < row_number; ++i)
-    {
-        for (std::size_t j = 0; j < col_number; ++j)
-        {
-            stream >> data_->at(j).at(i);
-        }
-    }
+    // 逐个读取数值后用std::from_chars解析，代替逐个元素的operator>>
+    ReadTextValues(stream, *data_);
 }
 
 BasicData::BasicData(const std::size_t &row_number,
@@ -101,22 +237,88 @@ void BasicData::resize(const std::size_t &row_number,
                        const std::size_t &col_number,
                        const double &init_value)
 {
-    data_->resize(col_number);
-    for (std::size_t i = 0; i < col_number; ++i)
+    if (float_data_)
     {
-        data_->at(i).resize(row_number, init_value);
+        float_data_->resize(
+            row_number, col_number, static_cast<float>(init_value));
+        return;
     }
+    data_->resize(row_number, col_number, init_value);
+}
+
+// 获取数据矩阵的拷贝
+std::vector<std::vector<double>> BasicData::get_data() const
+{
+    if (float_data_)
+    {
+        return ToDoubleVector(*float_data_);
+    }
+    return data_->to_vector();
+}
+
+// 改变存储精度
+void BasicData::set_precision(StoragePrecision precision)
+{
+    if (precision == get_precision())
+    {
+        return;
+    }
+    if (precision == StoragePrecision::float32)
+    {
+        float_data_ = std::make_shared<FloatColumnMatrix>(*data_);
+        data_ = std::make_shared<ColumnMatrix>();
+    }
+    else
+    {
+        data_ = std::make_shared<ColumnMatrix>(*float_data_);
+        float_data_.reset();
+    }
+}
+
+// 获取单精度存储的数据矩阵
+const FloatColumnMatrix &BasicData::get_float_matrix() const
+{
+    if (!float_data_)
+        throw std::logic_error("The data is not stored in single precision.");
+    return *float_data_;
+}
+
+// 获取指定列的数据
+std::vector<double> BasicData::get_col(const std::size_t &col_index) const
+{
+    return Visit([col_index](const auto &matrix) {
+        auto col = matrix.at(col_index);
+        return std::vector<double>(col.begin(), col.end());
+    });
+}
+
+// 获取指定行的数据
+std::vector<double> BasicData::get_row(const std::size_t &row_index) const
+{
+    if (row_index >= get_row_number())
+        throw std::out_of_range("Row index out of range.");
+    std::vector<double> row_data(get_col_number());
+    Visit([&](const auto &matrix) {
+        for (std::size_t j = 0; j < row_data.size(); ++j)
+        {
+            row_data[j] = matrix(row_index, j);
+        }
+    });
+    return row_data;
 }
 
 // 计算每一列信号的能量
 std::vector<double> BasicData::Energy() const
 {
     std::vector<double> energy(0);
-    for (const auto &col : *data_)
-    {
-        energy.push_back(
-            numerical_algorithm::CrossCorrelationAtShift(col, col, 0));
-    }
+    Visit([&energy](const auto &matrix) {
+        for (std::size_t j = 0; j < matrix.get_col_number(); ++j)
+        {
+            auto col = matrix[j];
+            energy.push_back(
+                std::inner_product(col.begin(), col.end(), col.begin(), 0.0));
+        }
+    });
     return energy;
 }
 
@@ -124,11 +326,14 @@ std::vector<double> BasicData::Energy() const
 std::vector<std::pair<double, size_t>> BasicData::PositiveMax() const
 {
     std::vector<std::pair<double, size_t>> max(0);
-    for (const auto &col : *data_)
-    {
-        auto max_index = std::max_element(col.begin(), col.end());
-        max.push_back(std::make_pair(*max_index, max_index - col.begin()));
-    }
+    Visit([&max](const auto &matrix) {
+        for (std::size_t j = 0; j < matrix.get_col_number(); ++j)
+        {
+            auto col = matrix[j];
+            auto max_index = std::max_element(col.begin(), col.end());
+            max.push_back(std::make_pair(*max_index, max_index - col.begin()));
+        }
+    });
     return max;
 }
 
@@ -136,11 +341,14 @@ std::vector<std::pair<double, size_t>> BasicData::PositiveMax() const
 std::vector<std::pair<double, size_t>> BasicData::NegativeMax() const
 {
     std::vector<std::pair<double, size_t>> max(0);
-    for (const auto &col : *data_)
-    {
-        auto max_index = std::min_element(col.begin(), col.end());
-        max.push_back(std::make_pair(*max_index, max_index - col.begin()));
-    }
+    Visit([&max](const auto &matrix) {
+        for (std::size_t j = 0; j < matrix.get_col_number(); ++j)
+        {
+            auto col = matrix[j];
+            auto max_index = std::min_element(col.begin(), col.end());
+            max.push_back(std::make_pair(*max_index, max_index - col.begin()));
+        }
+    });
     return max;
 }
 
@@ -148,15 +356,68 @@ std::vector<std::pair<double, size_t>> BasicData::NegativeMax() const
 std::vector<std::pair<double, size_t>> BasicData::AbsoluteMax() const
 {
     std::vector<std::pair<double, size_t>> max(0);
-    for (const auto &col : *data_)
+    Visit([&max](const auto &matrix) {
+        for (std::size_t j = 0; j < matrix.get_col_number(); ++j)
+        {
+            auto col = matrix[j];
+            auto max_index = std::max_element(
+                col.begin(), col.end(), [](const auto &a, const auto &b) {
+                    return std::abs(a) < std::abs(b);
+                });
+            max.push_back(std::make_pair(*max_index, max_index - col.begin()));
+        }
+    });
+    return max;
+}
+
+// 一次遍历计算每一列信号的全部统计量
+std::vector<ColumnStatistics>
+BasicData::Statistics(std::size_t thread_number) const
+{
+    std::vector<ColumnStatistics> statistics(get_col_number());
+    Visit([&](const auto &matrix) {
+        numerical_algorithm::ParallelFor(
+            statistics.size(),
+            [&](std::size_t j, std::size_t) {
+                statistics[j] = ComputeStatistics(matrix[j].data(),
+                                                  matrix.get_row_number());
+            },
+            thread_number);
+    });
+    return statistics;
+}
+
+// 计算各列的差
+void BasicData::ColumnDifference(BasicData &result, bool relative_to_base) const
+{
+    // 由惰性表达式一次求值到结果矩阵
+    auto difference = [relative_to_base](const auto &matrix) {
+        auto expression = MakeExpression(matrix);
+        auto output = std::make_shared<std::decay_t<decltype(matrix)>>();
+        (relative_to_base ? RelativeDifference(expression)
+                          : InterstoryDifference(expression))
+            .EvaluateTo(*output);
+        return output;
+    };
+    if (float_data_)
     {
-        auto max_index = std::max_element(
-            col.begin(), col.end(), [](const double &a, const double &b) {
-                return std::abs(a) < std::abs(b);
-            });
-        max.push_back(std::make_pair(*max_index, max_index - col.begin()));
+        result.data_ = std::make_shared<ColumnMatrix>();
+        result.float_data_ = difference(*float_data_);
     }
-    return max;
+    else
+    {
+        result.float_data_.reset();
+        result.data_ = difference(*data_);
+    }
+}
+
+// 非双精度存储时抛出std::logic_error
+void BasicData::CheckDoublePrecision() const
+{
+    if (float_data_)
+        throw std::logic_error(
+            "The data is stored in single precision, convert it with "
+            "set_precision(StoragePrecision::float64) first.");
 }
 
 } // namespace data_structure
@@ -29,12 +29,40 @@
 #include <vector>
 
 // project headers
+#include "column_matrix.h"
 #include "numerical_algorithm/vector_calculation.h"
 
 
 namespace data_structure
 {
 
+// 数据的存储精度
+enum class StoragePrecision
+{
+    // 双精度，默认的存储精度，可以获取列视图和连续存储的矩阵
+    float64,
+    // 单精度，内存减半，用于长期保存的数据；读取时转换为double
+    float32,
+};
+
+// 单列信号的统计量
+struct ColumnStatistics
+{
+    // 正向最大值及其索引
+    double max_{};
+    std::size_t max_index_{};
+    // 负向最大值（最小值）及其索引
+    double min_{};
+    std::size_t min_index_{};
+    // 绝对最大值（带符号）及其索引
+    double abs_max_{};
+    std::size_t abs_max_index_{};
+    // 能量（平方和）、均值和均方根
+    double energy_{}, mean_{}, rms_{};
+    // 过零次数（相邻两点异号的次数，恰为0的点不计）
+    std::size_t zero_crossing_{};
+};
+
 class BasicData
 {
 public:
@@ -44,18 +72,35 @@ public:
     // 从二维std::vector<std::vector<double>>构造
     // @param matrix 数据矩阵
     BasicData(const std::vector<std::vector<double>> &matrix)
-        : data_(std::make_shared<std::vector<std::vector<double>>>(matrix))
+        : data_(std::make_shared<ColumnMatrix>(matrix))
     {}
 
-    // 从std::shared_ptr<std::vector<std::vector<double>>>构造
+    // 从std::shared_ptr<std::vector<std::vector<double>>>构造，数据复制到连续
+    // 存储中，不再与原矩阵共享
     // @param matrix_ptr 数据矩阵
     BasicData(
         const std::shared_ptr<std::vector<std::vector<double>>> &matrix_ptr)
-        : data_(matrix_ptr)
+        : data_(std::make_shared<ColumnMatrix>(*matrix_ptr))
+    {}
+
+    // 从连续存储的矩阵构造
+    // @param matrix 数据矩阵
+    explicit BasicData(ColumnMatrix matrix)
+        : data_(std::make_shared<ColumnMatrix>(std::move(matrix)))
+    {}
+
+    // 与其他对象共享连续存储的矩阵，不复制数据
+    // @param matrix_ptr 数据矩阵指针，不能为空
+    explicit BasicData(std::shared_ptr<ColumnMatrix> matrix_ptr)
+        : data_(std::move(matrix_ptr))
     {}
 
-    // 从输入流构造
+    // 从输入流构造，按行优先的顺序读取以空白分隔的数值。数值逐个从流中读取后
+    // 解析，流停在第row_number*col_number个数值之后，其后的内容不被读取；数值
+    // 不足或无法解析时抛出TextParseError
     // @param stream 输入流
+    // @param row_number 行数
+    // @param col_number 列数
     BasicData(std::istream &stream,
               std::size_t row_number,
               std::size_t col_number);
@@ -63,11 +108,44 @@ public:
     // 析构函数
     virtual ~BasicData() = default;
 
-    // 获取数据矩阵的拷贝
-    const std::vector<std::vector<double>> &get_data() const { return *data_; }
+    // 获取数据矩阵的拷贝，单精度存储时转换为double
+    std::vector<std::vector<double>> get_data() const;
+
+    // 获取存储精度
+    StoragePrecision get_precision() const
+    {
+        return float_data_ ? StoragePrecision::float32
+                           : StoragePrecision::float64;
+    }
+
+    // 改变存储精度，转换为单精度时舍入到float。数据被复制到新的存储中，不影响
+    // 共享原存储的拷贝和视图
+    // @param precision 存储精度
+    void set_precision(StoragePrecision precision);
+
+    // 获取连续存储的数据矩阵，仅双精度存储时可用，否则抛出std::logic_error
+    const ColumnMatrix &get_matrix() const
+    {
+        CheckDoublePrecision();
+        return *data_;
+    }
+
+    // 获取共享的数据矩阵指针，用于创建不复制数据的视图，仅双精度存储时可用
+    std::shared_ptr<const ColumnMatrix> get_matrix_ptr() const
+    {
+        CheckDoublePrecision();
+        return data_;
+    }
+
+    // 获取数据矩阵的引用，仅双精度存储时可用
+    ColumnMatrix &data()
+    {
+        CheckDoublePrecision();
+        return *data_;
+    }
 
-    // 获取数据矩阵的引用
-    std::vector<std::vector<double>> &data() { return *data_; }
+    // 获取单精度存储的数据矩阵，仅单精度存储时可用，否则抛出std::logic_error
+    const FloatColumnMatrix &get_float_matrix() const;
 
     // 重新设置大小
     // @param row_number 行数
@@ -78,33 +156,36 @@ public:
                 const double &init_value = 0.0);
 
     // 获取行数
-    std::size_t get_row_number() const { return data_->front().size(); }
+    std::size_t get_row_number() const
+    {
+        return float_data_ ? float_data_->get_row_number()
+                           : data_->get_row_number();
+    }
     // 获取列数
-    std::size_t get_col_number() const { return data_->size(); }
+    std::size_t get_col_number() const
+    {
+        return float_data_ ? float_data_->get_col_number()
+                           : data_->get_col_number();
+    }
 
     // 获取指定列的数据
     // @param col_index 列索引
-    std::vector<double> get_col(const std::size_t &col_index) const
-    {
-        return data_->at(col_index);
-    }
+    std::vector<double> get_col(const std::size_t &col_index) const;
 
     // 获取指定行的数据
     // @param row_index 行索引
-    std::vector<double> get_row(const std::size_t &row_index) const
-    {
-        std::vector<double> row_data;
-        for (const auto &col : *data_)
-        {
-            row_data.push_back(col.at(row_index));
-        }
-        return row_data;
-    }
+    std::vector<double> get_row(const std::size_t &row_index) const;
 
-    // 获取指定行列的引用
+    // 获取指定列的视图，仅双精度存储时可用
     // @param col_index 列索引
-    std::vector<double> &col(const std::size_t &col_index)
+    ColumnView col(const std::size_t &col_index)
+    {
+        CheckDoublePrecision();
+        return data_->at(col_index);
+    }
+    ConstColumnView col(const std::size_t &col_index) const
     {
+        CheckDoublePrecision();
         return data_->at(col_index);
     }
 
@@ -124,14 +205,23 @@ public:
     // @return 每一列信号的绝对最大值及其索引
     std::vector<std::pair<double, size_t>> AbsoluteMax() const;
 
+    // 一次遍历计算每一列信号的全部统计量，各列并行计算
+    // 极值及其索引与PositiveMax、NegativeMax和AbsoluteMax的结果相同（相等时取
+    // 第一个）；能量的求和顺序不同，与Energy的结果可能有舍入误差
+    // @param thread_number 线程数量，0表示使用硬件线程数
+    // @return 每一列信号的统计量
+    std::vector<ColumnStatistics>
+    Statistics(std::size_t thread_number = 0) const;
+
     // 写入数据流，输出数据矩阵。列主序，行为时程，列为节点
     // @param output_stream 输出流
     void WriteToStream(std::ostream &output_stream) const;
 
 protected:
-    // 数据矩阵：列主序，行为时程，列为节点
-    std::shared_ptr<std::vector<std::vector<double>>> data_ =
-        std::make_shared<std::vector<std::vector<double>>>();
+    // 数据矩阵：列主序连续存储，行为时程，列为节点。单精度存储时为空矩阵
+    std::shared_ptr<ColumnMatrix> data_ = std::make_shared<ColumnMatrix>();
+    // 单精度存储的数据矩阵，双精度存储时为空指针
+    std::shared_ptr<FloatColumnMatrix> float_data_{};
 
     // 从指定大小构造
     // @param row_number 行数
@@ -140,6 +230,22 @@ protected:
     BasicData(const std::size_t &row_number,
               const std::size_t &col_number,
               const double &init_value = 0.0);
+
+    // 计算各列的差，结果的存储精度与本数据相同，差在double下计算
+    // @param result 结果，列数为本数据的列数减1
+    // @param relative_to_base 为true时第i列为第i+1列与第0列之差（相对底层），
+    //        否则为第i+1列与第i列之差（层间）
+    void ColumnDifference(BasicData &result, bool relative_to_base) const;
+
+    // 以存储的矩阵调用函数，function的参数为ColumnMatrix或FloatColumnMatrix
+    template <typename Function> decltype(auto) Visit(Function &&function) const
+    {
+        return float_data_ ? function(*float_data_) : function(*data_);
+    }
+
+private:
+    // 非双精度存储时抛出std::logic_error
+    void CheckDoublePrecision() const;
 };
 
 } // namespace data_structure
@@ -0,0 +1,235 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\binary_record.cpp
+** -----
+** File Created: Saturday, 17th October 2026 15:36:48
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 15:36:48
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 二进制记录格式的读写
+
+// associated header
+#include "binary_record.h"
+
+// stdc++ headers
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// project headers
+#include "column_matrix.h"
+#include "text_matrix_reader.h"
+
+
+namespace data_structure
+{
+
+namespace
+{
+
+static_assert(sizeof(BinaryRecordHeader) == 96,
+              "The binary record header must not contain padding.");
+static_assert(std::is_trivially_copyable<BinaryRecordHeader>::value,
+              "The binary record header must be trivially copyable.");
+
+// 向上取整到对齐字节数的整数倍
+inline std::uint64_t AlignOffset(std::uint64_t offset)
+{
+    constexpr std::uint64_t kAlignment = ColumnMatrix::kAlignment;
+    return (offset + kAlignment - 1) / kAlignment * kAlignment;
+}
+
+// 判断a * b是否不超过上限，不做可能溢出的乘法
+inline bool ProductWithin(std::uint64_t a, std::uint64_t b, std::uint64_t limit)
+{
+    return a == 0 || b <= limit / a;
+}
+
+// 写入一组double
+void WriteDoubles(std::ofstream &file, const std::vector<double> &values)
+{
+    file.write(reinterpret_cast<const char *>(values.data()),
+               values.size() * sizeof(double));
+}
+
+// 从映射的文件中读取一组double
+// @param data 映射的起始地址
+// @param offset 偏移量
+// @param number double的个数
+std::vector<double>
+ReadDoubles(const char *data, std::uint64_t offset, std::uint64_t number)
+{
+    std::vector<double> values(number);
+    std::memcpy(values.data(), data + offset, number * sizeof(double));
+    return values;
+}
+
+} // namespace
+
+// 写入二进制记录
+void WriteBinaryRecord(const std::string &file_path,
+                       const Acceleration &acceleration,
+                       const Building &building,
+                       const BinaryRecordInfo &info)
+{
+    if (info.direction_ * info.mea_number_ != acceleration.get_col_number())
+        throw std::invalid_argument(
+            "The column number does not match the direction layout.");
+
+    // 单精度存储的加速度转换为double写入
+    std::shared_ptr<const ColumnMatrix> matrix;
+    if (acceleration.get_precision() == StoragePrecision::float32)
+    {
+        matrix = std::make_shared<const ColumnMatrix>(
+            acceleration.get_float_matrix());
+    }
+    else
+    {
+        matrix = acceleration.get_matrix_ptr();
+    }
+
+    // 1.文件头
+    const auto &measure_height = building.get_measuren_height();
+    const auto &floor_height = building.get_floor_height();
+    BinaryRecordHeader header{};
+    std::memcpy(header.magic_, kBinaryRecordMagic, sizeof(header.magic_));
+    header.version_ = kBinaryRecordVersion;
+    header.row_number_ = matrix->get_row_number();
+    header.col_number_ = matrix->get_col_number();
+    header.stride_ = matrix->get_stride();
+    header.direction_ = info.direction_;
+    header.mea_number_ = info.mea_number_;
+    header.measure_height_number_ = measure_height.size();
+    header.floor_height_number_ = floor_height.size();
+    header.frequency_ = acceleration.get_frequency();
+    header.scale_ = info.scale_;
+    auto height_end =
+        sizeof(header)
+        + (measure_height.size() + floor_height.size()) * sizeof(double);
+    header.payload_offset_ = AlignOffset(height_end);
+
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        throw std::runtime_error("Cannot open the file: " + file_path);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    // 2.高度数据，补齐到对齐位置
+    WriteDoubles(file, measure_height);
+    WriteDoubles(file, floor_height);
+    std::vector<char> padding(header.payload_offset_ - height_end, 0);
+    file.write(padding.data(), padding.size());
+
+    // 3.加速度数据，按矩阵的存储原样写入（包括补齐部分）
+    file.write(reinterpret_cast<const char *>(matrix->data()),
+               header.col_number_ * header.stride_ * sizeof(double));
+    if (!file)
+        throw std::runtime_error("Cannot write the file: " + file_path);
+}
+
+// 读取二进制记录
+BinaryRecord ReadBinaryRecord(const std::string &file_path)
+{
+    auto file = std::make_shared<MappedFile>(file_path, true);
+
+    // 1.检查文件头
+    BinaryRecordHeader header{};
+    if (file->size() < sizeof(header))
+        throw std::runtime_error("The binary record is truncated.");
+    std::memcpy(&header, file->data(), sizeof(header));
+    if (std::memcmp(header.magic_, kBinaryRecordMagic, sizeof(header.magic_))
+        != 0)
+        throw std::runtime_error("The file is not a binary record.");
+    if (header.version_ != kBinaryRecordVersion)
+        throw std::runtime_error("Unsupported binary record version "
+                                 + std::to_string(header.version_) + ".");
+    // 各数量先与文件能容纳的double个数比较再相乘，损坏的文件头不会导致溢出
+    const std::uint64_t capacity = file->size() / sizeof(double);
+    if (header.measure_height_number_ > capacity
+        || header.floor_height_number_
+               > capacity - header.measure_height_number_
+        || !ProductWithin(header.direction_, header.mea_number_, capacity)
+        || !ProductWithin(header.col_number_, header.stride_, capacity)
+        || header.stride_ < header.row_number_)
+        throw std::runtime_error("The binary record header is invalid.");
+    auto height_end =
+        sizeof(header)
+        + (header.measure_height_number_ + header.floor_height_number_)
+              * sizeof(double);
+    if (header.payload_offset_ % ColumnMatrix::kAlignment != 0
+        || header.payload_offset_ < height_end
+        || header.stride_ != ColumnMatrix::AlignedStride(header.row_number_)
+        || header.col_number_ != header.direction_ * header.mea_number_)
+        throw std::runtime_error("The binary record header is invalid.");
+    if (header.payload_offset_ > file->size()
+        || (file->size() - header.payload_offset_) / sizeof(double)
+               < header.col_number_ * header.stride_)
+        throw std::runtime_error("The binary record is truncated.");
+
+    // 2.建筑信息和方向布局
+    BinaryRecord record;
+    auto measure_height = ReadDoubles(
+        file->data(), sizeof(header), header.measure_height_number_);
+    auto floor_height = ReadDoubles(
+        file->data(),
+        sizeof(header) + header.measure_height_number_ * sizeof(double),
+        header.floor_height_number_);
+    if (!floor_height.empty())
+    {
+        record.building_ = Building(measure_height, floor_height);
+    }
+    record.info_.direction_ = header.direction_;
+    record.info_.mea_number_ = header.mea_number_;
+    record.info_.scale_ = header.scale_;
+
+    // 3.加速度数据直接使用映射的页面，矩阵持有映射
+    auto payload =
+        reinterpret_cast<double *>(file->data() + header.payload_offset_);
+    auto matrix = std::make_shared<ColumnMatrix>(
+        payload, header.row_number_, header.col_number_, file);
+    record.acceleration_ = Acceleration(matrix, header.frequency_);
+    return record;
+}
+
+// 判断文件是否为二进制记录
+bool IsBinaryRecord(const std::string &file_path)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    char magic[sizeof(kBinaryRecordMagic)]{};
+    file.read(magic, sizeof(magic));
+    return file.gcount() == sizeof(magic)
+           && std::memcmp(magic, kBinaryRecordMagic, sizeof(magic)) == 0;
+}
+
+// 将文本格式的加速度数据转换为二进制记录
+void ConvertTextToBinaryRecord(const std::string &text_path,
+                               const std::string &binary_path,
+                               double frequency,
+                               const Building &building,
+                               const BinaryRecordInfo &info,
+                               std::size_t thread_number)
+{
+    Acceleration acceleration(
+        ReadTextMatrix(
+            text_path, info.direction_ * info.mea_number_, thread_number),
+        frequency,
+        info.scale_);
+    WriteBinaryRecord(binary_path, acceleration, building, info);
+}
+
+} // namespace data_structure
@@ -0,0 +1,132 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\binary_record.h
+** -----
+** File Created: Saturday, 17th October 2026 15:36:48
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 15:36:48
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 加速度和建筑信息的二进制记录格式，避免每次重新解析文本数据。
+// 文件布局（小端序）：
+//   [0, 96)      文件头BinaryRecordHeader：标识、版本、行列数、方向布局、
+//                采样频率、调幅系数、测点和楼层高度的数量
+//   [96, ...)    测点高度和楼层高度（double）
+//   payload      按64字节对齐的列主序加速度数据，与ColumnMatrix的存储相同
+//                （列长度补齐到64字节的整数倍，补齐部分为0）
+// 读取时以写时复制方式映射文件，加速度数据直接使用映射的页面，打开文件的开销
+// 与数据量无关，未修改的页面在进程之间共享。
+
+#ifndef DATA_STRUCTURE_BINARY_RECORD_H_
+#define DATA_STRUCTURE_BINARY_RECORD_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// project headers
+#include "acceleration.h"
+#include "building.h"
+
+
+namespace data_structure
+{
+
+// 二进制记录文件的标识
+constexpr char kBinaryRecordMagic[8] = {'q', 'R', 'E', 'S', 'T', 'R', 'E', 'C'};
+// 二进制记录的格式版本，格式不兼容地改变时递增
+constexpr std::uint32_t kBinaryRecordVersion = 1;
+
+// 二进制记录的文件头，各字段均为定长类型
+struct BinaryRecordHeader
+{
+    // 文件标识，kBinaryRecordMagic
+    char magic_[8];
+    // 格式版本
+    std::uint32_t version_;
+    // 保留字段，为0
+    std::uint32_t reserved_;
+    // 加速度数据相对文件起始的偏移量（字节），为64的整数倍
+    std::uint64_t payload_offset_;
+    // 行数（时刻数）、列数（通道数）和列间距（double的个数）
+    std::uint64_t row_number_, col_number_, stride_;
+    // 方向数量和每个方向的测点数量，列的排列方式与文本数据相同
+    std::uint64_t direction_, mea_number_;
+    // 测点高度和楼层高度的数量
+    std::uint64_t measure_height_number_, floor_height_number_;
+    // 采样频率
+    double frequency_;
+    // 读取原始数据时使用的调幅系数，数据已经调幅，仅作记录
+    double scale_;
+};
+
+// 二进制记录中的方向布局和调幅信息
+struct BinaryRecordInfo
+{
+    // 方向数量
+    std::size_t direction_{1};
+    // 每个方向的测点数量
+    std::size_t mea_number_{};
+    // 读取原始数据时使用的调幅系数
+    double scale_{1.0};
+};
+
+// 二进制记录
+struct BinaryRecord
+{
+    // 方向布局和调幅信息
+    BinaryRecordInfo info_{};
+    // 全部方向的加速度数据，读取时直接使用映射的页面
+    Acceleration acceleration_{};
+    // 建筑信息
+    Building building_{};
+};
+
+// 写入二进制记录
+// @param file_path 文件路径
+// @param acceleration 全部方向的加速度数据，列数须为方向数量与测点数量之积
+// @param building 建筑信息
+// @param info 方向布局和调幅信息
+void WriteBinaryRecord(const std::string &file_path,
+                       const Acceleration &acceleration,
+                       const Building &building,
+                       const BinaryRecordInfo &info);
+
+// 读取二进制记录，文件格式不正确时抛出std::runtime_error
+// @param file_path 文件路径
+// @return 二进制记录，加速度数据与内存映射共享，映射在数据释放后解除
+BinaryRecord ReadBinaryRecord(const std::string &file_path);
+
+// 判断文件是否为二进制记录（只检查文件标识）
+// @param file_path 文件路径
+// @return 是否为二进制记录
+bool IsBinaryRecord(const std::string &file_path);
+
+// 将文本格式的加速度数据转换为二进制记录，文本格式见ReadTextMatrix。加速度按
+// 读取文本时的方式调整均值并调幅
+// @param text_path 文本文件路径
+// @param binary_path 二进制记录文件路径
+// @param frequency 采样频率
+// @param building 建筑信息
+// @param info 方向布局和调幅信息
+// @param thread_number 解析文本的线程数量，0表示使用硬件线程数
+void ConvertTextToBinaryRecord(const std::string &text_path,
+                               const std::string &binary_path,
+                               double frequency,
+                               const Building &building,
+                               const BinaryRecordInfo &info,
+                               std::size_t thread_number = 0);
+
+} // namespace data_structure
+
+#endif // DATA_STRUCTURE_BINARY_RECORD_H_
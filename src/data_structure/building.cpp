@@ -26,8 +26,12 @@
 #include <vector>
 
 // third-party library headers
+#include "eigen3/Eigen/Core"
 #include "nlohmann/json.hpp"
 
+// project headers
+#include "numerical_algorithm/interp.h"
+
 namespace data_structure
 {
 // 从配置文件读取
@@ -55,6 +59,31 @@ void Building::LoadConfig(const std::string &config_file)
     calculate_inter_height();
 }
 
+// 获取测点位移到楼层位移的插值权重矩阵
+const Eigen::MatrixXd &
+Building::get_interp_weight(numerical_algorithm::InterpType interp_type)
+{
+    // 高度通过非常量引用获取，可能在外部被修改，改变后重新计算
+    if (weight_measure_height_ != measure_height_
+        || weight_floor_height_ != floor_height_)
+    {
+        interp_weight_.clear();
+        weight_measure_height_ = measure_height_;
+        weight_floor_height_ = floor_height_;
+    }
+    auto it = interp_weight_.find(interp_type);
+    if (it == interp_weight_.end())
+    {
+        numerical_algorithm::Interp interp(interp_type);
+        it = interp_weight_
+                 .emplace(interp_type,
+                          interp.InterpolationWeight(measure_height_,
+                                                     floor_height_))
+                 .first;
+    }
+    return it->second;
+}
+
 // 计算建筑层间高度
 void Building::calculate_inter_height()
 {
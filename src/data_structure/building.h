@@ -25,9 +25,16 @@
 
 // stdc++ headers
 #include <cstddef>
+#include <map>
 #include <string>
 #include <vector>
 
+// third-party library headers
+#include "eigen3/Eigen/Core"
+
+// project headers
+#include "numerical_algorithm/interp.h"
+
 namespace data_structure
 {
 
@@ -58,13 +65,27 @@ public:
 
     // 获取建筑测点高度
     std::vector<double> &get_measuren_height() { return measure_height_; }
+    const std::vector<double> &get_measuren_height() const
+    {
+        return measure_height_;
+    }
 
     // 获取建筑楼层高度
     std::vector<double> &get_floor_height() { return floor_height_; }
+    const std::vector<double> &get_floor_height() const
+    {
+        return floor_height_;
+    }
 
     // 获取建筑层间高度
     std::vector<double> &get_inter_height() { return inter_height_; }
 
+    // 获取测点位移到楼层位移的插值权重矩阵，首次调用或高度改变后计算
+    // @param interp_type 插值算法类型，插值结果须为测点值的线性函数
+    // @return 权重矩阵，尺寸为楼层数×测点数
+    const Eigen::MatrixXd &
+    get_interp_weight(numerical_algorithm::InterpType interp_type);
+
 private:
     // 建筑测点高度坐标
     std::vector<double> measure_height_{};
@@ -72,6 +93,10 @@ private:
     std::vector<double> floor_height_{};
     // 建筑层间高度
     std::vector<double> inter_height_{};
+    // 各插值算法的插值权重矩阵，以及计算时的测点和楼层高度
+    std::map<numerical_algorithm::InterpType, Eigen::MatrixXd>
+        interp_weight_{};
+    std::vector<double> weight_measure_height_{}, weight_floor_height_{};
 
     // 计算层间高度
     void calculate_inter_height();
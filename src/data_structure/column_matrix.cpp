@@ -0,0 +1,281 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\column_matrix.cpp
+** -----
+** File Created: Friday, 16th October 2026 18:10:44
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 18:10:44
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 列主序连续存储的矩阵类的实现，对double和float显式实例化。
+
+// associated header
+#include "column_matrix.h"
+
+// stdc++ headers
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+namespace data_structure
+{
+
+namespace
+{
+
+// 检查外部存储的持有者不为空。持有者为空的删除器会按自己分配的存储释放内存，
+// 因此须在构造data_之前检查
+// @param owner 外部存储的持有者
+// @return 持有者
+std::shared_ptr<void> CheckOwner(std::shared_ptr<void> owner)
+{
+    if (!owner)
+        throw std::invalid_argument("The external storage has no owner.");
+    return owner;
+}
+
+} // namespace
+
+// 列长度补齐到对齐字节数的整数倍
+template <typename T>
+std::size_t BasicColumnMatrix<T>::AlignedStride(std::size_t row_number)
+{
+    constexpr std::size_t kBlock = kAlignment / sizeof(T);
+    return (row_number + kBlock - 1) / kBlock * kBlock;
+}
+
+// 从指定大小构造
+template <typename T>
+BasicColumnMatrix<T>::BasicColumnMatrix(std::size_t row_number,
+                                        std::size_t col_number,
+                                        T init_value)
+{
+    resize(row_number, col_number, init_value);
+}
+
+// 从二维std::vector构造
+template <typename T>
+BasicColumnMatrix<T>::BasicColumnMatrix(
+    const std::vector<std::vector<T>> &matrix)
+{
+    *this = matrix;
+}
+
+// 从另一种元素类型的矩阵转换，补齐部分同样转换（均为0）
+template <typename T>
+template <typename U>
+BasicColumnMatrix<T>::BasicColumnMatrix(const BasicColumnMatrix<U> &other)
+    : row_number_(other.row_number_), col_number_(other.col_number_),
+      stride_(AlignedStride(other.row_number_)),
+      data_(Allocate(stride_ * other.col_number_))
+{
+    for (std::size_t j = 0; j < col_number_; ++j)
+    {
+        auto col = data_.get() + j * stride_;
+        auto other_col = other.data_.get() + j * other.stride_;
+        std::transform(other_col,
+                       other_col + row_number_,
+                       col,
+                       [](U value) { return static_cast<T>(value); });
+        std::fill(col + row_number_, col + stride_, T());
+    }
+}
+
+// 使用外部存储构造
+template <typename T>
+BasicColumnMatrix<T>::BasicColumnMatrix(T *data,
+                                        std::size_t row_number,
+                                        std::size_t col_number,
+                                        std::shared_ptr<void> owner)
+    : row_number_(row_number), col_number_(col_number),
+      stride_(AlignedStride(row_number)),
+      data_(data, AlignedDeleter{CheckOwner(std::move(owner))})
+{
+    if (reinterpret_cast<std::uintptr_t>(data) % kAlignment != 0)
+        throw std::invalid_argument("The external storage is not aligned.");
+}
+
+// 拷贝构造
+template <typename T>
+BasicColumnMatrix<T>::BasicColumnMatrix(const BasicColumnMatrix &other)
+    : row_number_(other.row_number_), col_number_(other.col_number_),
+      stride_(other.stride_), data_(Allocate(other.stride_ * other.col_number_))
+{
+    std::copy(other.data_.get(),
+              other.data_.get() + stride_ * col_number_,
+              data_.get());
+}
+
+// 移动构造，被移动的矩阵变为空矩阵
+template <typename T>
+BasicColumnMatrix<T>::BasicColumnMatrix(BasicColumnMatrix &&other) noexcept
+    : row_number_(std::exchange(other.row_number_, 0)),
+      col_number_(std::exchange(other.col_number_, 0)),
+      stride_(std::exchange(other.stride_, 0)), data_(std::move(other.data_))
+{}
+
+// 拷贝赋值
+template <typename T>
+BasicColumnMatrix<T> &
+BasicColumnMatrix<T>::operator=(const BasicColumnMatrix &other)
+{
+    if (this != &other)
+    {
+        BasicColumnMatrix copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+// 移动赋值，被移动的矩阵变为空矩阵
+template <typename T>
+BasicColumnMatrix<T> &
+BasicColumnMatrix<T>::operator=(BasicColumnMatrix &&other) noexcept
+{
+    row_number_ = std::exchange(other.row_number_, 0);
+    col_number_ = std::exchange(other.col_number_, 0);
+    stride_ = std::exchange(other.stride_, 0);
+    data_ = std::move(other.data_);
+    return *this;
+}
+
+// 从二维std::vector赋值
+template <typename T>
+BasicColumnMatrix<T> &
+BasicColumnMatrix<T>::operator=(const std::vector<std::vector<T>> &matrix)
+{
+    std::size_t row_number = matrix.empty() ? 0 : matrix.front().size();
+    for (const auto &col : matrix)
+    {
+        if (col.size() != row_number)
+            throw std::invalid_argument(
+                "All columns of the matrix must have the same length.");
+    }
+
+    BasicColumnMatrix result;
+    result.row_number_ = row_number;
+    result.col_number_ = matrix.size();
+    result.stride_ = AlignedStride(row_number);
+    result.data_ = Allocate(result.stride_ * result.col_number_);
+    for (std::size_t j = 0; j < matrix.size(); ++j)
+    {
+        auto col = result.data_.get() + j * result.stride_;
+        std::copy(matrix[j].begin(), matrix[j].end(), col);
+        std::fill(col + row_number, col + result.stride_, T());
+    }
+    return *this = std::move(result);
+}
+
+// 重新设置大小
+template <typename T>
+void BasicColumnMatrix<T>::resize(std::size_t row_number,
+                                  std::size_t col_number,
+                                  T init_value)
+{
+    if (row_number == row_number_ && col_number == col_number_)
+    {
+        return;
+    }
+
+    // 重新分配并复制重叠部分，其余部分设为初始化值，补齐部分设为0
+    auto stride = AlignedStride(row_number);
+    auto data = Allocate(stride * col_number);
+    auto copy_rows = std::min(row_number, row_number_);
+    for (std::size_t j = 0; j < col_number; ++j)
+    {
+        auto col = data.get() + j * stride;
+        std::size_t copied = 0;
+        if (j < col_number_)
+        {
+            auto old_col = data_.get() + j * stride_;
+            std::copy(old_col, old_col + copy_rows, col);
+            copied = copy_rows;
+        }
+        std::fill(col + copied, col + row_number, init_value);
+        std::fill(col + row_number, col + stride, T());
+    }
+    row_number_ = row_number;
+    col_number_ = col_number;
+    stride_ = stride;
+    data_ = std::move(data);
+}
+
+// 获取指定列的视图，检查索引
+template <typename T>
+typename BasicColumnMatrix<T>::ColumnView
+BasicColumnMatrix<T>::at(std::size_t col_index)
+{
+    if (col_index >= col_number_)
+        throw std::out_of_range("Column index out of range.");
+    return (*this)[col_index];
+}
+
+// 获取指定列的只读视图，检查索引
+template <typename T>
+typename BasicColumnMatrix<T>::ConstColumnView
+BasicColumnMatrix<T>::at(std::size_t col_index) const
+{
+    if (col_index >= col_number_)
+        throw std::out_of_range("Column index out of range.");
+    return (*this)[col_index];
+}
+
+// 复制为二维std::vector
+template <typename T>
+std::vector<std::vector<T>> BasicColumnMatrix<T>::to_vector() const
+{
+    std::vector<std::vector<T>> matrix(col_number_);
+    for (std::size_t j = 0; j < col_number_; ++j)
+    {
+        matrix[j] = (*this)[j].to_vector();
+    }
+    return matrix;
+}
+
+// 按对齐要求释放内存
+template <typename T>
+void BasicColumnMatrix<T>::AlignedDeleter::operator()(T *pointer) const
+{
+    if (!owner_)
+    {
+        ::operator delete[](pointer, std::align_val_t(kAlignment));
+    }
+}
+
+// 按对齐要求分配内存
+template <typename T>
+std::unique_ptr<T[], typename BasicColumnMatrix<T>::AlignedDeleter>
+BasicColumnMatrix<T>::Allocate(std::size_t size)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+    return std::unique_ptr<T[], AlignedDeleter>(static_cast<T *>(
+        ::operator new[](size * sizeof(T), std::align_val_t(kAlignment))));
+}
+
+// 显式实例化
+template class BasicColumnMatrix<double>;
+template class BasicColumnMatrix<float>;
+template BasicColumnMatrix<double>::BasicColumnMatrix(
+    const BasicColumnMatrix<float> &);
+template BasicColumnMatrix<float>::BasicColumnMatrix(
+    const BasicColumnMatrix<double> &);
+
+} // namespace data_structure
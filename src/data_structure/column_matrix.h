@@ -0,0 +1,261 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\column_matrix.h
+** -----
+** File Created: Friday, 16th October 2026 18:10:44
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 18:10:44
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 列主序连续存储的矩阵类，行为时程，列为节点。
+// 所有数据位于一块按64字节对齐的内存中，每列的起始地址均对齐（列长度补齐到
+// 64字节的整数倍，补齐部分为0），可直接交给向量化计算、Eigen和FFTW使用；
+// 列通过不持有数据的列视图访问。元素类型可以是double或float（用于长期保存
+// 的数据，内存减半）。
+
+#ifndef DATA_STRUCTURE_COLUMN_MATRIX_H_
+#define DATA_STRUCTURE_COLUMN_MATRIX_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+
+namespace data_structure
+{
+
+// 列视图类，类似std::span，不持有数据，矩阵改变大小后失效
+// @tparam T 元素类型（double、float）或其const类型
+template <typename T> class BasicColumnView
+{
+public:
+    using value_type = std::remove_const_t<T>;
+    using iterator = T *;
+
+    // 默认构造函数，空视图
+    BasicColumnView() = default;
+
+    // 由数据指针和长度构造
+    // @param data 数据指针
+    // @param size 数据长度
+    BasicColumnView(T *data, std::size_t size) : data_(data), size_(size) {}
+
+    // 由可写视图构造只读视图
+    template <typename U,
+              typename = std::enable_if_t<std::is_convertible<U *, T *>::value>>
+    BasicColumnView(const BasicColumnView<U> &other)
+        : data_(other.data()), size_(other.size())
+    {}
+
+    // 获取数据指针
+    T *data() const { return data_; }
+
+    // 获取数据长度
+    std::size_t size() const { return size_; }
+
+    // 是否为空
+    bool empty() const { return size_ == 0; }
+
+    // 迭代器
+    iterator begin() const { return data_; }
+    iterator end() const { return data_ + size_; }
+
+    // 访问元素，不检查索引
+    T &operator[](std::size_t index) const { return data_[index]; }
+
+    // 首尾元素
+    T &front() const { return data_[0]; }
+    T &back() const { return data_[size_ - 1]; }
+
+    // 复制为std::vector
+    // @return 列数据的拷贝
+    std::vector<value_type> to_vector() const
+    {
+        return std::vector<value_type>(data_, data_ + size_);
+    }
+
+private:
+    T *data_{nullptr};
+    std::size_t size_{0};
+};
+
+// 可写列视图
+using ColumnView = BasicColumnView<double>;
+// 只读列视图
+using ConstColumnView = BasicColumnView<const double>;
+// 单精度的可写和只读列视图
+using FloatColumnView = BasicColumnView<float>;
+using ConstFloatColumnView = BasicColumnView<const float>;
+
+// 列主序连续存储的矩阵类
+// @tparam T 元素类型，double或float
+template <typename T> class BasicColumnMatrix
+{
+public:
+    using value_type = T;
+    using ColumnView = BasicColumnView<T>;
+    using ConstColumnView = BasicColumnView<const T>;
+
+    // 内存对齐字节数
+    static constexpr std::size_t kAlignment = 64;
+
+    // 默认构造函数，空矩阵
+    BasicColumnMatrix() = default;
+
+    // 从指定大小构造
+    // @param row_number 行数
+    // @param col_number 列数
+    // @param init_value 初始化值
+    BasicColumnMatrix(std::size_t row_number,
+                      std::size_t col_number,
+                      T init_value = T());
+
+    // 从二维std::vector构造，每个vector为一列
+    // @param matrix 数据矩阵，各列长度必须相同
+    explicit BasicColumnMatrix(const std::vector<std::vector<T>> &matrix);
+
+    // 从另一种元素类型的矩阵转换
+    // @param other 另一种元素类型的矩阵
+    template <typename U>
+    explicit BasicColumnMatrix(const BasicColumnMatrix<U> &other);
+
+    // 使用外部存储构造，不复制数据（如内存映射文件中的数据）。data须按
+    // kAlignment对齐，列间距为行数补齐后的值，补齐部分应为0。拷贝得到的矩阵和
+    // 改变大小后的矩阵使用自己分配的存储
+    // @param data 外部存储的起始地址
+    // @param row_number 行数
+    // @param col_number 列数
+    // @param owner 外部存储的持有者，矩阵使用外部存储期间保持其有效，不能为空
+    //        （为空时抛出std::invalid_argument）。矩阵不释放外部存储，仅释放对
+    //        持有者的引用；外部存储无需释放时（如栈上的数组）可传入空删除器的
+    //        shared_ptr
+    BasicColumnMatrix(T *data,
+                      std::size_t row_number,
+                      std::size_t col_number,
+                      std::shared_ptr<void> owner);
+
+    // 拷贝和移动
+    BasicColumnMatrix(const BasicColumnMatrix &other);
+    BasicColumnMatrix(BasicColumnMatrix &&other) noexcept;
+    BasicColumnMatrix &operator=(const BasicColumnMatrix &other);
+    BasicColumnMatrix &operator=(BasicColumnMatrix &&other) noexcept;
+
+    // 从二维std::vector赋值，每个vector为一列
+    // @param matrix 数据矩阵，各列长度必须相同
+    BasicColumnMatrix &operator=(const std::vector<std::vector<T>> &matrix);
+
+    // 析构函数
+    ~BasicColumnMatrix() = default;
+
+    // 重新设置大小，保留原有数据，新增元素设为初始化值
+    // @param row_number 行数
+    // @param col_number 列数
+    // @param init_value 初始化值
+    void resize(std::size_t row_number,
+                std::size_t col_number,
+                T init_value = T());
+
+    // 获取行数
+    std::size_t get_row_number() const { return row_number_; }
+    // 获取列数
+    std::size_t get_col_number() const { return col_number_; }
+    // 获取相邻两列起始位置的间距（不小于行数）
+    std::size_t get_stride() const { return stride_; }
+
+    // 列长度补齐到对齐字节数的整数倍
+    // @param row_number 行数
+    // @return 该行数的矩阵的列间距
+    static std::size_t AlignedStride(std::size_t row_number);
+
+    // 获取数据指针，第j列第i行位于[j * get_stride() + i]
+    T *data() { return data_.get(); }
+    const T *data() const { return data_.get(); }
+
+    // 获取指定列的视图，不检查索引
+    // @param col_index 列索引
+    ColumnView operator[](std::size_t col_index)
+    {
+        return {data_.get() + col_index * stride_, row_number_};
+    }
+    ConstColumnView operator[](std::size_t col_index) const
+    {
+        return {data_.get() + col_index * stride_, row_number_};
+    }
+
+    // 获取指定列的视图，索引越界时抛出std::out_of_range
+    // @param col_index 列索引
+    ColumnView at(std::size_t col_index);
+    ConstColumnView at(std::size_t col_index) const;
+
+    // 获取指定行列的元素，不检查索引
+    // @param row_index 行索引
+    // @param col_index 列索引
+    T &operator()(std::size_t row_index, std::size_t col_index)
+    {
+        return data_[col_index * stride_ + row_index];
+    }
+    T operator()(std::size_t row_index, std::size_t col_index) const
+    {
+        return data_[col_index * stride_ + row_index];
+    }
+
+    // 兼容std::vector<std::vector<double>>的接口：列数、是否为空、首尾列
+    std::size_t size() const { return col_number_; }
+    bool empty() const { return col_number_ == 0; }
+    ColumnView front() { return at(0); }
+    ConstColumnView front() const { return at(0); }
+    ColumnView back() { return at(col_number_ - 1); }
+    ConstColumnView back() const { return at(col_number_ - 1); }
+
+    // 复制为二维std::vector，每个vector为一列
+    // @return 数据矩阵的拷贝
+    std::vector<std::vector<T>> to_vector() const;
+
+private:
+    template <typename U> friend class BasicColumnMatrix;
+
+    // 按对齐要求释放内存；使用外部存储时只释放对持有者的引用
+    struct AlignedDeleter
+    {
+        std::shared_ptr<void> owner_{};
+        void operator()(T *pointer) const;
+    };
+
+    // 行数、列数和列间距
+    std::size_t row_number_{0}, col_number_{0}, stride_{0};
+    // 连续存储的数据
+    std::unique_ptr<T[], AlignedDeleter> data_{};
+
+    // 按对齐要求分配内存
+    // @param size 元素个数
+    static std::unique_ptr<T[], AlignedDeleter> Allocate(std::size_t size);
+};
+
+// 双精度矩阵
+using ColumnMatrix = BasicColumnMatrix<double>;
+// 单精度矩阵
+using FloatColumnMatrix = BasicColumnMatrix<float>;
+
+// 各元素类型的实现位于column_matrix.cpp，仅对double和float显式实例化
+extern template class BasicColumnMatrix<double>;
+extern template class BasicColumnMatrix<float>;
+extern template BasicColumnMatrix<double>::BasicColumnMatrix(
+    const BasicColumnMatrix<float> &);
+extern template BasicColumnMatrix<float>::BasicColumnMatrix(
+    const BasicColumnMatrix<double> &);
+
+
+} // namespace data_structure
+
+#endif // DATA_STRUCTURE_COLUMN_MATRIX_H_
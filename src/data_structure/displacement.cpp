@@ -27,28 +27,18 @@ namespace data_structure
 // 求解楼层相对底层的位移
 Displacement Displacement::relative_displacement() const
 {
-    Displacement result(data_->front().size(), data_->size() - 1, frequency_);
-    for (std::size_t i = 0; i < result.data_->size(); ++i)
-    {
-        for (std::size_t j = 0; j < result.data_->at(i).size(); ++j)
-        {
-            result.data_->at(i)[j] = data_->at(i + 1)[j] - data_->at(0)[j];
-        }
-    }
+    Displacement result;
+    result.frequency_ = frequency_;
+    ColumnDifference(result, true);
     return result;
 }
 
 // 求解层间相对位移
 Displacement Displacement::interstory_displacement() const
 {
-    Displacement result(data_->front().size(), data_->size() - 1, frequency_);
-    for (std::size_t i = 0; i < result.data_->size(); ++i)
-    {
-        for (std::size_t j = 0; j < result.data_->at(i).size(); ++j)
-        {
-            result.data_->at(i)[j] = data_->at(i + 1)[j] - data_->at(i)[j];
-        }
-    }
+    Displacement result;
+    result.frequency_ = frequency_;
+    ColumnDifference(result, false);
     return result;
 }
 } // namespace data_structure
\ No newline at end of file
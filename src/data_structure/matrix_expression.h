@@ -0,0 +1,252 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\matrix_expression.h
+** -----
+** File Created: Saturday, 17th October 2026 18:02:26
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 18:02:26
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 按列求值的惰性矩阵表达式（表达式模板）。相对底层的差、层间差和按列缩放等
+// 运算只记录操作数，不生成中间矩阵；求值时对每一列执行一次融合的循环，直接写入
+// 结果矩阵。例如层间位移角：
+//   DivideColumns(InterstoryDifference(MakeExpression(displacement)),
+//                 inter_height).EvaluateTo(drift);
+// 表达式引用操作数，操作数须在求值之前保持有效。
+
+#ifndef DATA_STRUCTURE_MATRIX_EXPRESSION_H_
+#define DATA_STRUCTURE_MATRIX_EXPRESSION_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+// project headers
+#include "column_matrix.h"
+
+
+namespace data_structure
+{
+
+// 矩阵表达式的基类，Derived须提供get_row_number()、get_col_number()和
+// column(j)，column(j)返回的对象以operator[](i)给出第j列第i行的值（double）
+template <typename Derived> class MatrixExpression
+{
+public:
+    const Derived &derived() const
+    {
+        return static_cast<const Derived &>(*this);
+    }
+
+    // 获取行数和列数
+    std::size_t get_row_number() const { return derived().get_row_number(); }
+    std::size_t get_col_number() const { return derived().get_col_number(); }
+
+    // 获取第j列第i行的值
+    double operator()(std::size_t row_index, std::size_t col_index) const
+    {
+        return derived().column(col_index)[row_index];
+    }
+
+    // 求值并写入结果矩阵，结果矩阵的大小自动调整
+    // @param result 结果矩阵，可以是double或float矩阵，不能是表达式的操作数
+    template <typename T> void EvaluateTo(BasicColumnMatrix<T> &result) const
+    {
+        result.resize(get_row_number(), get_col_number());
+        for (std::size_t j = 0; j < get_col_number(); ++j)
+        {
+            auto source = derived().column(j);
+            auto target = result[j];
+            for (std::size_t i = 0; i < target.size(); ++i)
+            {
+                target[i] = static_cast<T>(source[i]);
+            }
+        }
+    }
+
+    // 求值为新的双精度矩阵
+    ColumnMatrix Evaluate() const
+    {
+        ColumnMatrix result;
+        EvaluateTo(result);
+        return result;
+    }
+};
+
+// 矩阵的引用，表达式的叶节点
+// @tparam T 矩阵的元素类型，float在读取时转换为double
+template <typename T>
+class MatrixReference : public MatrixExpression<MatrixReference<T>>
+{
+public:
+    // 列的访问
+    struct Column
+    {
+        const T *data_;
+        double operator[](std::size_t i) const { return data_[i]; }
+    };
+
+    explicit MatrixReference(const BasicColumnMatrix<T> &matrix)
+        : matrix_(matrix)
+    {}
+
+    std::size_t get_row_number() const { return matrix_.get_row_number(); }
+    std::size_t get_col_number() const { return matrix_.get_col_number(); }
+    Column column(std::size_t j) const { return {matrix_[j].data()}; }
+
+private:
+    const BasicColumnMatrix<T> &matrix_;
+};
+
+// 列的差：第j列为操作数第j+1列与第0列（相对底层）或第j列（层间）之差
+template <typename E>
+class ColumnDifferenceExpression
+    : public MatrixExpression<ColumnDifferenceExpression<E>>
+{
+public:
+    // 列的访问
+    struct Column
+    {
+        typename E::Column upper_, lower_;
+        double operator[](std::size_t i) const
+        {
+            return upper_[i] - lower_[i];
+        }
+    };
+
+    // @param expression 操作数，至少有一列
+    // @param relative_to_base 为true时减去第0列，否则减去相邻的下一列
+    ColumnDifferenceExpression(const E &expression, bool relative_to_base)
+        : expression_(expression), relative_to_base_(relative_to_base)
+    {
+        if (expression.get_col_number() == 0)
+            throw std::invalid_argument("The matrix has no column.");
+    }
+
+    std::size_t get_row_number() const
+    {
+        return expression_.get_row_number();
+    }
+    std::size_t get_col_number() const
+    {
+        return expression_.get_col_number() - 1;
+    }
+    Column column(std::size_t j) const
+    {
+        return {expression_.column(j + 1),
+                expression_.column(relative_to_base_ ? 0 : j)};
+    }
+
+private:
+    E expression_;
+    bool relative_to_base_;
+};
+
+// 按列缩放：第j列的每个值与factor[j]按Operation运算（乘或除）
+template <typename E, typename Operation>
+class ColumnScaleExpression
+    : public MatrixExpression<ColumnScaleExpression<E, Operation>>
+{
+public:
+    // 列的访问
+    struct Column
+    {
+        typename E::Column source_;
+        double factor_;
+        double operator[](std::size_t i) const
+        {
+            return Operation()(source_[i], factor_);
+        }
+    };
+
+    // @param expression 操作数
+    // @param factor 各列的系数，长度不小于操作数的列数
+    ColumnScaleExpression(const E &expression,
+                          const std::vector<double> &factor)
+        : expression_(expression), factor_(factor)
+    {
+        if (factor.size() < expression.get_col_number())
+            throw std::invalid_argument(
+                "The number of factors is less than the column number.");
+    }
+
+    std::size_t get_row_number() const
+    {
+        return expression_.get_row_number();
+    }
+    std::size_t get_col_number() const
+    {
+        return expression_.get_col_number();
+    }
+    Column column(std::size_t j) const
+    {
+        return {expression_.column(j), factor_[j]};
+    }
+
+private:
+    E expression_;
+    const std::vector<double> &factor_;
+};
+
+// 由矩阵创建表达式
+// @param matrix 矩阵
+template <typename T>
+MatrixReference<T> MakeExpression(const BasicColumnMatrix<T> &matrix)
+{
+    return MatrixReference<T>(matrix);
+}
+
+// 相对底层的差（各列减去第0列，结果少一列）
+// @param expression 操作数
+template <typename E>
+ColumnDifferenceExpression<E>
+RelativeDifference(const MatrixExpression<E> &expression)
+{
+    return ColumnDifferenceExpression<E>(expression.derived(), true);
+}
+
+// 层间差（各列减去相邻的下一列，结果少一列）
+// @param expression 操作数
+template <typename E>
+ColumnDifferenceExpression<E>
+InterstoryDifference(const MatrixExpression<E> &expression)
+{
+    return ColumnDifferenceExpression<E>(expression.derived(), false);
+}
+
+// 各列乘以对应的系数
+// @param expression 操作数
+// @param factor 各列的系数，须在求值之前保持有效
+template <typename E>
+ColumnScaleExpression<E, std::multiplies<double>>
+ScaleColumns(const MatrixExpression<E> &expression,
+             const std::vector<double> &factor)
+{
+    return {expression.derived(), factor};
+}
+
+// 各列除以对应的除数
+// @param expression 操作数
+// @param divisor 各列的除数，须在求值之前保持有效
+template <typename E>
+ColumnScaleExpression<E, std::divides<double>>
+DivideColumns(const MatrixExpression<E> &expression,
+              const std::vector<double> &divisor)
+{
+    return {expression.derived(), divisor};
+}
+
+} // namespace data_structure
+
+#endif // DATA_STRUCTURE_MATRIX_EXPRESSION_H_
@@ -0,0 +1,502 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\text_matrix_reader.cpp
+** -----
+** File Created: Saturday, 17th October 2026 14:05:12
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 14:05:12
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 文本数据快速读取的实现
+
+// associated header
+#include "text_matrix_reader.h"
+
+// stdc++ headers
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+// platform headers
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// project headers
+#include "numerical_algorithm/parallel.h"
+
+
+namespace data_structure
+{
+
+namespace
+{
+
+// 每个线程至少处理的字节数，文件较小时不分块
+constexpr std::size_t kMinChunkSize = 1 << 16;
+
+// 从流中读取时单个数值的最大长度（字符数）
+constexpr std::size_t kMaxTokenSize = 64;
+
+// 是否为行内的空白字符（不含换行符）
+inline bool IsBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// 跳过UTF-8的BOM
+// @param begin 文本起始地址
+// @param end 文本结束地址
+// @return 跳过BOM后的起始地址
+const char *SkipBom(const char *begin, const char *end)
+{
+    if (end - begin >= 3 && std::memcmp(begin, "\xEF\xBB\xBF", 3) == 0)
+    {
+        return begin + 3;
+    }
+    return begin;
+}
+
+// 获取当前行的结束位置（换行符或文本结束）
+inline const char *LineEnd(const char *line, const char *end)
+{
+    auto eol = static_cast<const char *>(std::memchr(line, '\n', end - line));
+    return eol ? eol : end;
+}
+
+// 解析一个数值，数值之后必须是空白、换行或文本结束
+// @param position 数值的起始位置，解析成功后移到数值之后
+// @param end 文本结束地址
+// @param value 解析得到的数值
+// @return 是否解析成功
+inline bool ParseNumber(const char *&position, const char *end, double &value)
+{
+    auto first = position;
+    // std::from_chars不接受正号，operator>>接受
+    if (first != end && *first == '+')
+    {
+        ++first;
+    }
+    auto result = std::from_chars(first, end, value);
+    if (result.ec != std::errc() || result.ptr == first
+        || (result.ptr != end && *result.ptr != '\n' && !IsBlank(*result.ptr)))
+    {
+        return false;
+    }
+    position = result.ptr;
+    return true;
+}
+
+// 抛出解析错误，行号和列号由出错位置计算
+// @param message 错误信息
+// @param text 文本起始地址
+// @param position 出错位置
+[[noreturn]] void ThrowParseError(const std::string &message,
+                                  const char *text,
+                                  const char *position)
+{
+    std::size_t line = 1 + std::count(text, position, '\n');
+    auto line_begin = position;
+    while (line_begin != text && line_begin[-1] != '\n')
+    {
+        --line_begin;
+    }
+    std::size_t column = 1 + (position - line_begin);
+    throw TextParseError(message, line, column);
+}
+
+// 将文本按行的边界分块，每块的起始位置均为行首
+// @param begin 文本起始地址
+// @param end 文本结束地址
+// @param thread_number 线程数量
+// @return 各块的边界，共块数+1个
+std::vector<const char *>
+SplitLines(const char *begin, const char *end, std::size_t thread_number)
+{
+    std::size_t size = end - begin;
+    std::size_t chunk_number = std::max<std::size_t>(
+        1, std::min(thread_number * 4, size / kMinChunkSize));
+    if (thread_number == 1)
+    {
+        chunk_number = 1;
+    }
+    std::vector<const char *> bounds{begin};
+    for (std::size_t k = 1; k < chunk_number; ++k)
+    {
+        auto target = std::max(begin + size / chunk_number * k, bounds.back());
+        auto eol = LineEnd(target, end);
+        bounds.push_back(eol == end ? end : eol + 1);
+    }
+    bounds.push_back(end);
+    return bounds;
+}
+
+// 统计非空行的数量
+// @param begin 块的起始地址（行首）
+// @param end 块的结束地址
+// @return 非空行的数量
+std::size_t CountRows(const char *begin, const char *end)
+{
+    std::size_t row_number = 0;
+    for (auto line = begin; line != end;)
+    {
+        auto eol = LineEnd(line, end);
+        row_number += std::find_if_not(line, eol, IsBlank) != eol;
+        line = eol == end ? end : eol + 1;
+    }
+    return row_number;
+}
+
+// 统计第一个非空行中以空白分隔的值的数量
+// @param begin 文本起始地址
+// @param end 文本结束地址
+// @return 值的数量，没有非空行时为0
+std::size_t CountColumns(const char *begin, const char *end)
+{
+    for (auto line = begin; line != end;)
+    {
+        auto eol = LineEnd(line, end);
+        std::size_t col_number = 0;
+        for (auto p = std::find_if_not(line, eol, IsBlank); p != eol;
+             p = std::find_if_not(p, eol, IsBlank))
+        {
+            ++col_number;
+            p = std::find_if(p, eol, IsBlank);
+        }
+        if (col_number != 0)
+        {
+            return col_number;
+        }
+        line = eol == end ? end : eol + 1;
+    }
+    return 0;
+}
+
+// 一块文本的解析错误
+struct ChunkError
+{
+    // 出错位置，无错误时为nullptr
+    const char *position_{nullptr};
+    std::string message_{};
+};
+
+// 解析一块文本并写入矩阵
+// @param begin 块的起始地址（行首）
+// @param end 块的结束地址
+// @param row 块内第一个非空行在矩阵中的行索引
+// @param matrix 预先分配的矩阵
+// @return 解析错误
+ChunkError ParseRows(const char *begin,
+                     const char *end,
+                     std::size_t row,
+                     ColumnMatrix &matrix)
+{
+    auto col_number = matrix.get_col_number();
+    for (auto line = begin; line != end;)
+    {
+        auto eol = LineEnd(line, end);
+        auto p = std::find_if_not(line, eol, IsBlank);
+        if (p != eol)
+        {
+            std::size_t j = 0;
+            for (; p != eol; p = std::find_if_not(p, eol, IsBlank), ++j)
+            {
+                if (j == col_number)
+                {
+                    return {p,
+                            "Too many values in a line, expected "
+                                + std::to_string(col_number) + "."};
+                }
+                if (!ParseNumber(p, end, matrix(row, j)))
+                {
+                    return {p, "Invalid number."};
+                }
+            }
+            if (j != col_number)
+            {
+                return {eol,
+                        "Too few values in a line, expected "
+                            + std::to_string(col_number) + " but found "
+                            + std::to_string(j) + "."};
+            }
+            ++row;
+        }
+        line = eol == end ? end : eol + 1;
+    }
+    return {};
+}
+
+} // namespace
+
+// 由错误信息和出错位置构造
+TextParseError::TextParseError(const std::string &message,
+                               std::size_t line,
+                               std::size_t column)
+    : std::runtime_error(message + " (line " + std::to_string(line)
+                         + ", column " + std::to_string(column) + ")"),
+      line_(line), column_(column)
+{}
+
+#ifdef _WIN32
+
+// 映射整个文件
+MappedFile::MappedFile(const std::string &file_path, bool copy_on_write)
+{
+    HANDLE file = CreateFileA(file_path.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        throw std::runtime_error("Cannot open the file: " + file_path);
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size))
+    {
+        CloseHandle(file);
+        throw std::runtime_error("Cannot get the file size: " + file_path);
+    }
+    size_ = static_cast<std::size_t>(file_size.QuadPart);
+    if (size_ == 0)
+    {
+        CloseHandle(file);
+        return;
+    }
+    HANDLE mapping = CreateFileMappingA(file,
+                                        nullptr,
+                                        copy_on_write ? PAGE_WRITECOPY
+                                                      : PAGE_READONLY,
+                                        0,
+                                        0,
+                                        nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr)
+        throw std::runtime_error("Cannot map the file: " + file_path);
+    // 视图保持映射对象有效，映射句柄可以立即关闭
+    data_ = static_cast<char *>(MapViewOfFile(
+        mapping, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (data_ == nullptr)
+        throw std::runtime_error("Cannot map the file: " + file_path);
+}
+
+// 解除映射
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+    }
+}
+
+#else
+
+// 映射整个文件
+MappedFile::MappedFile(const std::string &file_path, bool copy_on_write)
+{
+    int file = open(file_path.c_str(), O_RDONLY);
+    if (file < 0)
+        throw std::runtime_error("Cannot open the file: " + file_path);
+    struct stat file_status{};
+    if (fstat(file, &file_status) != 0)
+    {
+        close(file);
+        throw std::runtime_error("Cannot get the file size: " + file_path);
+    }
+    size_ = static_cast<std::size_t>(file_status.st_size);
+    if (size_ == 0)
+    {
+        close(file);
+        return;
+    }
+    // 映射在文件关闭后仍然有效
+    void *data = mmap(nullptr,
+                      size_,
+                      copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ,
+                      MAP_PRIVATE,
+                      file,
+                      0);
+    close(file);
+    if (data == MAP_FAILED)
+        throw std::runtime_error("Cannot map the file: " + file_path);
+    if (!copy_on_write)
+    {
+        // 只读映射用于顺序解析文本
+        madvise(data, size_, MADV_SEQUENTIAL);
+    }
+    data_ = static_cast<char *>(data);
+}
+
+// 解除映射
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr)
+    {
+        munmap(data_, size_);
+    }
+}
+
+#endif
+
+// 解析文本矩阵
+ColumnMatrix ParseTextMatrix(const char *begin,
+                             const char *end,
+                             std::size_t col_number,
+                             std::size_t thread_number)
+{
+    auto text = begin;
+    begin = SkipBom(begin, end);
+    if (col_number == 0)
+    {
+        col_number = CountColumns(begin, end);
+    }
+    thread_number = numerical_algorithm::ActualThreadNumber(
+        static_cast<std::size_t>(end - begin) / kMinChunkSize, thread_number);
+
+    // 1.按行的边界分块，统计各块的非空行数，确定各块在矩阵中的起始行
+    auto bounds = SplitLines(begin, end, thread_number);
+    std::size_t chunk_number = bounds.size() - 1;
+    std::vector<std::size_t> first_row(chunk_number + 1, 0);
+    numerical_algorithm::ParallelFor(
+        chunk_number,
+        [&](std::size_t k, std::size_t) {
+            first_row[k + 1] = CountRows(bounds[k], bounds[k + 1]);
+        },
+        thread_number);
+    for (std::size_t k = 0; k < chunk_number; ++k)
+    {
+        first_row[k + 1] += first_row[k];
+    }
+
+    // 2.预先分配矩阵，各块解析后直接写入对应的行
+    ColumnMatrix matrix(first_row.back(), col_number);
+    std::vector<ChunkError> errors(chunk_number);
+    numerical_algorithm::ParallelFor(
+        chunk_number,
+        [&](std::size_t k, std::size_t) {
+            errors[k] =
+                ParseRows(bounds[k], bounds[k + 1], first_row[k], matrix);
+        },
+        thread_number);
+
+    // 3.报告文本中第一个错误
+    for (const auto &error : errors)
+    {
+        if (error.position_ != nullptr)
+        {
+            ThrowParseError(error.message_, text, error.position_);
+        }
+    }
+    return matrix;
+}
+
+// 读取文本矩阵文件
+ColumnMatrix ReadTextMatrix(const std::string &file_path,
+                            std::size_t col_number,
+                            std::size_t thread_number)
+{
+    MappedFile file(file_path);
+    return ParseTextMatrix(
+        file.data(), file.data() + file.size(), col_number, thread_number);
+}
+
+// 从输入流按行优先的顺序读取以空白分隔的数值填满矩阵
+void ReadTextValues(std::istream &stream, ColumnMatrix &matrix)
+{
+    std::istream::sentry sentry(stream, true);
+    if (!sentry)
+    {
+        throw TextParseError("Input stream is invalid.", 1, 1);
+    }
+    auto buffer = stream.rdbuf();
+    using traits = std::istream::traits_type;
+    auto is_space = [](char c) { return c == '\n' || IsBlank(c); };
+    // 数值逐个读入较小的缓冲区后解析，流中只消耗到最后一个数值为止
+    char token[kMaxTokenSize];
+    std::size_t line = 1, column = 1, count = 0;
+    for (std::size_t i = 0; i < matrix.get_row_number(); ++i)
+    {
+        for (std::size_t j = 0; j < matrix.get_col_number(); ++j, ++count)
+        {
+            auto c = buffer->sgetc();
+            while (!traits::eq_int_type(c, traits::eof())
+                   && is_space(traits::to_char_type(c)))
+            {
+                if (traits::to_char_type(c) == '\n')
+                {
+                    ++line;
+                    column = 0;
+                }
+                ++column;
+                c = buffer->snextc();
+            }
+            if (traits::eq_int_type(c, traits::eof()))
+            {
+                stream.setstate(std::ios::eofbit | std::ios::failbit);
+                throw TextParseError(
+                    "Too few values, expected "
+                        + std::to_string(matrix.get_row_number()
+                                         * matrix.get_col_number())
+                        + " but found " + std::to_string(count) + ".",
+                    line,
+                    column);
+            }
+            std::size_t length = 0;
+            while (!traits::eq_int_type(c, traits::eof())
+                   && !is_space(traits::to_char_type(c)))
+            {
+                if (length < kMaxTokenSize)
+                {
+                    token[length] = traits::to_char_type(c);
+                }
+                ++length;
+                c = buffer->snextc();
+            }
+            if (traits::eq_int_type(c, traits::eof()))
+            {
+                stream.setstate(std::ios::eofbit);
+            }
+            const char *p = token;
+            auto end = token + std::min(length, kMaxTokenSize);
+            if (count == 0)
+            {
+                p = SkipBom(p, end);
+            }
+            if (length > kMaxTokenSize || !ParseNumber(p, end, matrix(i, j)))
+            {
+                stream.setstate(std::ios::failbit);
+                throw TextParseError("Invalid number.", line, column);
+            }
+            column += length;
+        }
+    }
+}
+
+} // namespace data_structure
@@ -0,0 +1,124 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\data_structure\text_matrix_reader.h
+** -----
+** File Created: Saturday, 17th October 2026 14:05:12
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 14:05:12
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 文本数据的快速读取：文件以只读内存映射的方式打开，数值用std::from_chars
+// 解析。读取分两遍进行，第一遍统计行数以预先分配矩阵，第二遍解析数值并直接
+// 写入矩阵；两遍均可按行的边界分块后由多个线程完成。解析错误时抛出
+// TextParseError，给出出错位置的行号和列号。
+
+#ifndef DATA_STRUCTURE_TEXT_MATRIX_READER_H_
+#define DATA_STRUCTURE_TEXT_MATRIX_READER_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <iosfwd>
+#include <stdexcept>
+#include <string>
+
+// project headers
+#include "column_matrix.h"
+
+
+namespace data_structure
+{
+
+// 文本数据解析错误
+class TextParseError : public std::runtime_error
+{
+public:
+    // 由错误信息和出错位置构造
+    // @param message 错误信息
+    // @param line 行号，从1开始
+    // @param column 列号（行内的字符位置），从1开始
+    TextParseError(const std::string &message,
+                   std::size_t line,
+                   std::size_t column);
+
+    // 获取出错的行号
+    std::size_t get_line() const { return line_; }
+    // 获取出错的列号
+    std::size_t get_column() const { return column_; }
+
+private:
+    std::size_t line_{}, column_{};
+};
+
+// 内存映射文件，映射在对象析构时解除
+class MappedFile
+{
+public:
+    // 映射整个文件，文件无法打开时抛出std::runtime_error
+    // @param file_path 文件路径
+    // @param copy_on_write 为false时只读映射；为true时写时复制映射，映射的
+    //        内容可以修改，修改只影响本进程，未修改的页面在进程之间共享
+    explicit MappedFile(const std::string &file_path,
+                        bool copy_on_write = false);
+
+    // 禁止拷贝
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    // 析构函数，解除映射并关闭文件
+    ~MappedFile();
+
+    // 获取文件内容的起始地址，空文件时为nullptr。映射按页对齐
+    const char *data() const { return data_; }
+    // 获取可修改的文件内容，仅写时复制映射时可以写入
+    char *data() { return data_; }
+    // 获取文件大小（字节）
+    std::size_t size() const { return size_; }
+
+private:
+    // 映射的起始地址和大小，映射建立后文件句柄即可关闭
+    char *data_{nullptr};
+    std::size_t size_{0};
+};
+
+// 解析文本矩阵。每个非空行为一个时刻，行内各值以空白分隔，第j个值写入第j列；
+// 空行（只含空白的行）被忽略。各行的值数量与列数不同时抛出TextParseError
+// @param begin 文本起始地址
+// @param end 文本结束地址
+// @param col_number 列数，0表示由第一个非空行确定
+// @param thread_number 线程数量，0表示使用硬件线程数
+// @return 数据矩阵
+ColumnMatrix ParseTextMatrix(const char *begin,
+                             const char *end,
+                             std::size_t col_number = 0,
+                             std::size_t thread_number = 1);
+
+// 读取文本矩阵文件，格式见ParseTextMatrix
+// @param file_path 文件路径
+// @param col_number 列数，0表示由第一个非空行确定
+// @param thread_number 线程数量，0表示使用硬件线程数
+// @return 数据矩阵
+ColumnMatrix ReadTextMatrix(const std::string &file_path,
+                            std::size_t col_number = 0,
+                            std::size_t thread_number = 1);
+
+// 从输入流按行优先的顺序读取以空白分隔的数值填满矩阵，不要求数值按行排列
+// （与逐个使用operator>>读取相同）。数值逐个从流中读取，流停在最后一个数值
+// 之后，不依赖tellg/seekg，文本模式（CRLF）和不可定位的流同样适用。数值不足
+// 或无法解析时设置流的failbit并抛出TextParseError，行号和列号从流的当前位置
+// 开始计算
+// @param stream 输入流
+// @param matrix 预先设置好大小的矩阵
+void ReadTextValues(std::istream &stream, ColumnMatrix &matrix);
+
+} // namespace data_structure
+
+#endif // DATA_STRUCTURE_TEXT_MATRIX_READER_H_
@@ -28,6 +28,7 @@
 
 // project headers
 #include "data_structure/acceleration.h"
+#include "data_structure/acceleration_view.h"
 #include "data_structure/building.h"
 #include "data_structure/displacement.h"
 #include "data_structure/inter_story_drift.h"
@@ -72,11 +73,11 @@ public:
     // 默认构造函数
     BasicEdpCalculation() = default;
 
-    // 从加速度数据中构造
+    // 从加速度数据或加速度视图中构造，不复制加速度数据
     // @param acceleration 加速度数据
     // @param building 建筑信息
     explicit BasicEdpCalculation(
-        const data_structure::Acceleration &acceleration,
+        const data_structure::AccelerationView &acceleration,
         const data_structure::Building &building)
         : input_acceleration_(acceleration), building_(building)
     {}
@@ -105,8 +106,8 @@ public:
 protected:
     // 完成计算的标志
     bool is_calculated_ = false;
-    // 单方向加速度数据指针
-    data_structure::Acceleration input_acceleration_{};
+    // 单方向加速度数据的视图，与输入的加速度数据共享存储
+    data_structure::AccelerationView input_acceleration_{};
     // 建筑信息的指针
     data_structure::Building building_{};
 };
@@ -31,6 +31,7 @@
 
 // project headers
 #include "data_structure/displacement.h"
+#include "data_structure/matrix_expression.h"
 
 #include "numerical_algorithm/basic_filtering.h"
 #include "numerical_algorithm/butterworth_filter_design.h"
@@ -66,6 +67,8 @@ void FilteringIntegral::LoadConfig(const std::string &config_file)
     method_.filter_type_ = config["FilterConfig"]["filter_type"];
     method_.filter_function_ = config["FilterConfig"]["filter_function"];
     method_.filter_generator_ = config["FilterConfig"]["filter_generator"];
+    method_.filter_structure_ = config["FilterConfig"].value(
+        "filter_structure", method_.filter_structure_);
     method_.interp_type_ = config["InterpConfig"]["interp_type"];
 }
 
@@ -87,15 +90,15 @@ void FilteringIntegral::CalculateEdp()
     {
         case numerical_algorithm::FilterFunction::filtfilt:
             filter_function = std::make_shared<numerical_algorithm::FiltFilt>(
-                filter_generator);
+                filter_generator, method_.filter_structure_);
             break;
         case numerical_algorithm::FilterFunction::filter:
-            filter_function =
-                std::make_shared<numerical_algorithm::Filter>(filter_generator);
+            filter_function = std::make_shared<numerical_algorithm::Filter>(
+                filter_generator, method_.filter_structure_);
             break;
         default:
             filter_function = std::make_shared<numerical_algorithm::FiltFilt>(
-                filter_generator);
+                filter_generator, method_.filter_structure_);
             break;
     }
 
@@ -117,21 +120,27 @@ void FilteringIntegral::CalculateEdp()
     auto filtered_displacement = filter_function->Filtering(displacement);
     // 2.6 位移插值
     result_.displacement_.set_frequency(input_acceleration_.get_frequency());
-    result_.displacement_.data() =
-        interp_function.Interpolation(building_.get_measuren_height(),
-                                      filtered_displacement,
-                                      building_.get_floor_height());
-    // 2.7 计算层间位移
-    auto interstory_displacement =
-        result_.displacement_.interstory_displacement();
-    auto interstory_height = building_.get_inter_height();
-    // 2.8 计算层间位移角
-    for (std::size_t i = 0; i < interstory_displacement.data().size(); ++i)
+    // 插值结果为测点位移的线性函数时，使用建筑的插值权重矩阵一次计算全部时刻
+    if (interp_function.IsLinear())
     {
-        result_.inter_story_drift_.data().push_back(
-            numerical_algorithm::VectorOperation(
-                interstory_displacement.data()[i], interstory_height[i], '/'));
+        result_.displacement_.data() = interp_function.Interpolation(
+            building_.get_interp_weight(method_.interp_type_),
+            filtered_displacement);
     }
+    else
+    {
+        result_.displacement_.data() =
+            interp_function.Interpolation(building_.get_measuren_height(),
+                                          filtered_displacement,
+                                          building_.get_floor_height());
+    }
+    // 2.7 计算层间位移角：层间位移除以层高，一次求值直接写入结果，不生成层间
+    // 位移矩阵
+    data_structure::DivideColumns(
+        data_structure::InterstoryDifference(data_structure::MakeExpression(
+            result_.displacement_.get_matrix())),
+        building_.get_inter_height())
+        .EvaluateTo(result_.inter_story_drift_.data());
 
     // 3.计算完成
     is_calculated_ = true;
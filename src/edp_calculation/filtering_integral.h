@@ -58,6 +58,11 @@ struct FilteringIntegralMethod
     // *filtfilt：零相位双向滤波
     numerical_algorithm::FilterFunction filter_function_ =
         numerical_algorithm::FilterFunction::filtfilt;
+    // 滤波器结构：
+    // *transfer_function：传递函数多项式；
+    // second_order_sections：二阶节级联
+    numerical_algorithm::FilterStructure filter_structure_ =
+        numerical_algorithm::FilterStructure::transfer_function;
     // 滤波器类型：
     // *butter：巴特沃斯滤波器；
     numerical_algorithm::FilterGenerator filter_generator_ =
@@ -80,9 +85,9 @@ public:
     FilteringIntegral() = default;
 
     // 从配置文件中读取参数构造
-    // @param acceleration 加速度数据
+    // @param acceleration 加速度数据或加速度视图
     // @param building 建筑结构信息
-    FilteringIntegral(const data_structure::Acceleration &acceleration,
+    FilteringIntegral(const data_structure::AccelerationView &acceleration,
                       data_structure::Building &building)
         : BasicEdpCalculation(acceleration, building)
     {
@@ -90,12 +95,12 @@ public:
     }
 
     // 从加速度数据中构造，默认使用巴特沃斯滤波器，零相位双向滤波，带通滤波
-    // @param acceleration 加速度数据
+    // @param acceleration 加速度数据或加速度视图
     // @param building 建筑结构信息
     // @param filter_order 滤波器阶数
     // @param low_frequency 滤波器低频截止频率
     // @param high_frequency 滤波器高频截止频率
-    FilteringIntegral(const data_structure::Acceleration &acceleration,
+    FilteringIntegral(const data_structure::AccelerationView &acceleration,
                       data_structure::Building &building,
                       int filter_order,
                       double low_frequency,
@@ -24,9 +24,11 @@
 #include "modified_filtering_integral.h"
 
 // stdc++ headers
+#include <algorithm>
 #include <fstream>
 #include <memory>
 #include <numeric>
+#include <stdexcept>
 #include <vector>
 
 // third-party library headers
@@ -34,17 +36,41 @@
 
 // project headers
 #include <data_structure/displacement.h>
+#include "data_structure/matrix_expression.h"
 #include "numerical_algorithm/basic_filtering.h"
 #include "numerical_algorithm/butterworth_filter_design.h"
 #include "numerical_algorithm/filter.h"
+#include "numerical_algorithm/filter_design_cache.h"
 #include "numerical_algorithm/filtfilt.h"
+#include "numerical_algorithm/frequency_filtering.h"
 #include "numerical_algorithm/integral.h"
 #include "numerical_algorithm/interp.h"
+#include "numerical_algorithm/parallel.h"
+#include "numerical_algorithm/scratch_arena.h"
 #include "numerical_algorithm/vector_calculation.h"
 
 
 namespace edp_calculation
 {
+
+namespace
+{
+// 低频截止频率扫描使用的带通滤波器阶数
+constexpr int kSweepFilterOrder = 2;
+
+// 检查扫描参数，默认候选必须是有效的候选序号
+void CheckSweepParameter(const LowCutSweepParameter &sweep)
+{
+    if (sweep.candidate_number_ < 1)
+        throw std::invalid_argument(
+            "The low-cut candidate number must be at least 1.");
+    if (sweep.default_candidate_ < 0
+        || sweep.default_candidate_ >= sweep.candidate_number_)
+        throw std::invalid_argument(
+            "The default low-cut candidate is out of range.");
+}
+} // namespace
+
 // 从配置文件中读取参数
 void ModifiedFilteringIntegral::LoadConfig(const std::string &config_file)
 {
@@ -65,12 +91,35 @@ void ModifiedFilteringIntegral::LoadConfig(const std::string &config_file)
     method_.filter_type_ = config["FilterConfig"]["filter_type"];
     method_.filter_function_ = config["FilterConfig"]["filter_function"];
     method_.filter_generator_ = config["FilterConfig"]["filter_generator"];
+    method_.filter_structure_ = config["FilterConfig"].value(
+        "filter_structure", method_.filter_structure_);
     method_.interp_type_ = config["InterpConfig"]["interp_type"];
+
+    // 低频截止频率扫描参数（可选）
+    if (config.contains("LowCutSweepConfig"))
+    {
+        auto &sweep_config = config["LowCutSweepConfig"];
+        sweep_.candidate_number_ =
+            sweep_config.value("candidate_number", sweep_.candidate_number_);
+        sweep_.default_candidate_ =
+            sweep_config.value("default_candidate", sweep_.default_candidate_);
+        sweep_.thread_number_ =
+            sweep_config.value("thread_number", sweep_.thread_number_);
+        sweep_.early_stop_ =
+            sweep_config.value("early_stop", sweep_.early_stop_);
+        sweep_.search_limit_ =
+            sweep_config.value("search_limit", sweep_.search_limit_);
+        sweep_.engine_ = sweep_config.value("engine", sweep_.engine_);
+        CheckSweepParameter(sweep_);
+    }
 }
 
 // 滤波积分插值法计算的入口
 void ModifiedFilteringIntegral::CalculateEdp()
 {
+    // 扫描参数也可能通过get_sweep_parameter修改，计算前再检查一次
+    CheckSweepParameter(sweep_);
+
     // 1.确定计算参数
     // 1.1确定滤波生成器
     auto filter_generator = numerical_algorithm::ButterworthFilterDesign(
@@ -83,15 +132,15 @@ void ModifiedFilteringIntegral::CalculateEdp()
     {
         case numerical_algorithm::FilterFunction::filtfilt:
             filter_function = std::make_shared<numerical_algorithm::FiltFilt>(
-                filter_generator);
+                filter_generator, method_.filter_structure_);
             break;
         case numerical_algorithm::FilterFunction::filter:
-            filter_function =
-                std::make_shared<numerical_algorithm::Filter>(filter_generator);
+            filter_function = std::make_shared<numerical_algorithm::Filter>(
+                filter_generator, method_.filter_structure_);
             break;
         default:
             filter_function = std::make_shared<numerical_algorithm::FiltFilt>(
-                filter_generator);
+                filter_generator, method_.filter_structure_);
             break;
     }
 
@@ -101,123 +150,247 @@ void ModifiedFilteringIntegral::CalculateEdp()
     // 2.滤波积分插值计算层间位移角
     // 2.1 逐列滤波积分得到测点位移
     std::vector<std::vector<double>> filtered_displacement(
-        input_acceleration_.get_data().size());
-    for (std::size_t i = 0; i < input_acceleration_.get_data().size(); ++i)
+        input_acceleration_.get_col_number());
+    for (std::size_t i = 0; i < filtered_displacement.size(); ++i)
     {
         filtered_displacement[i] = CalculateSingle(i);
     }
 
     // 2.2 位移插值
     result_.displacement_.set_frequency(input_acceleration_.get_frequency());
-    result_.displacement_.data() =
-        interp_function.Interpolation(building_.get_measuren_height(),
-                                      filtered_displacement,
-                                      building_.get_floor_height());
-    // 2.3 计算层间位移
-    auto interstory_displacement =
-        result_.displacement_.interstory_displacement();
-    auto interstory_height = building_.get_inter_height();
-    // 2.4 计算层间位移角
-    for (std::size_t i = 0; i < interstory_displacement.data().size(); ++i)
+    // 插值结果为测点位移的线性函数时，使用建筑的插值权重矩阵一次计算全部时刻
+    if (interp_function.IsLinear())
+    {
+        result_.displacement_.data() = interp_function.Interpolation(
+            building_.get_interp_weight(method_.interp_type_),
+            filtered_displacement);
+    }
+    else
     {
-        result_.inter_story_drift_.data().push_back(
-            numerical_algorithm::VectorOperation(
-                interstory_displacement.data()[i], interstory_height[i], '/'));
+        result_.displacement_.data() =
+            interp_function.Interpolation(building_.get_measuren_height(),
+                                          filtered_displacement,
+                                          building_.get_floor_height());
     }
+    // 2.3 计算层间位移角：层间位移除以层高，一次求值直接写入结果，不生成层间
+    // 位移矩阵
+    data_structure::DivideColumns(
+        data_structure::InterstoryDifference(data_structure::MakeExpression(
+            result_.displacement_.get_matrix())),
+        building_.get_inter_height())
+        .EvaluateTo(result_.inter_story_drift_.data());
 
     // 3.计算完成
     is_calculated_ = true;
 }
 
+// 扫描线程私有的工作区
+struct ModifiedFilteringIntegral::SweepWorkspace
+{
+    // 当前候选的滤波器设计（来自全局设计缓存）和滤波方法
+    std::shared_ptr<const numerical_algorithm::ButterworthFilterDesign>
+        filter_design{};
+    numerical_algorithm::FiltFilt filter_function{};
+    // 滤波积分的中间结果缓冲区
+    std::vector<double> buffer_a{}, buffer_b{};
+    // 频域方式的滤波器系数、频率响应和逆变换工作区
+    std::vector<double> coefficients_a{}, coefficients_b{}, response{};
+    numerical_algorithm::FrequencyFiltering::Workspace spectrum_workspace{};
+    // 当前候选的位移
+    std::vector<double> displacement{};
+};
+
 // 滤波积分插值法计算单列加速度
 std::vector<double>
 ModifiedFilteringIntegral::CalculateSingle(const std::size_t &col)
 {
-    // 1.初步到速度和位移
+    const auto acceleration = input_acceleration_.get_col(col);
     double dt = input_acceleration_.get_time_step();
+    int max_k = sweep_.candidate_number_;
 
-    auto velocity_0 =
-        numerical_algorithm::Cumtrapz(input_acceleration_.get_data()[col], dt);
-    auto displacement_0 = numerical_algorithm::Cumtrapz(velocity_0, dt);
-
-    // 2.滤波积分，得到不同低频限值下的结果
-    int max_k = 100;
-    // 2.1储存每次滤波积分的临时结果
-    std::vector<std::vector<double>> integral_velocity(max_k),
-        integral_displacement(max_k), filtered_acceleration(max_k),
-        filtered_velocity(max_k), filtered_displacement(max_k);
-    // 2.2设置滤波积分方法
-    auto filter_generator = numerical_algorithm::ButterworthFilterDesign(2);
-    auto filter_function = numerical_algorithm::FiltFilt();
-    double low, high = 20.0 / input_acceleration_.get_frequency() * 2;
-    double low_scale = high / 20;
-    for (int i = 0; i < max_k; ++i)
+    // 1.初步积分到速度和位移，仅保留位移的功率，中间结果为临时向量
+    double power_0 = 0.0;
     {
-        // 2.3 设置滤波参数
-        low = 1.0 * (i + 1) / max_k * low_scale;
-        filter_generator.set_frequency(low, high);
-        filter_generator.DesignFilter();
-        filter_function.set_coefficients(filter_generator);
-
-        // 2.4 滤波积分
-        filtered_acceleration[i] =
-            filter_function.Filtering(input_acceleration_.get_data()[col]);
-        integral_velocity[i] =
-            numerical_algorithm::Cumtrapz(filtered_acceleration[i], dt);
-        filtered_velocity[i] = filter_function.Filtering(integral_velocity[i]);
-        integral_displacement[i] =
-            numerical_algorithm::Cumtrapz(filtered_velocity[i], dt);
-        filtered_displacement[i] =
-            filter_function.Filtering(integral_displacement[i]);
+        auto velocity_0 = numerical_algorithm::MakeScratchVector();
+        auto displacement_0 = numerical_algorithm::MakeScratchVector();
+        numerical_algorithm::Cumtrapz(acceleration, dt, velocity_0);
+        numerical_algorithm::Cumtrapz(velocity_0, dt, displacement_0);
+        power_0 = std::accumulate(displacement_0.begin(),
+                                  displacement_0.end(),
+                                  0.0,
+                                  [](double x, double y) { return x + y * y; });
     }
 
-    // 3.根据功率比选择最佳结果
-    // 3.1 计算功率比
-    std::vector<double> power_ratio(max_k, 0.0);
-    power_ratio[0] =
-        std::accumulate(filtered_displacement[0].begin(),
-                        filtered_displacement[0].end(),
-                        0.0,
-                        [](double x, double y) { return x + y * y; })
-        / std::accumulate(displacement_0.begin(),
-                          displacement_0.end(),
-                          0.0,
-                          [](double x, double y) { return x + y * y; });
-    for (std::size_t i = 1; i < max_k; ++i)
+    // 2.按截止频率递增的顺序逐批并行扫描，每个候选仅保留位移的功率
+    // 2.1 确定扫描范围和每批的候选数量，频域方式下各候选共用一次正向FFT
+    int search_number = sweep_.search_limit_ > 0
+                            ? std::min(sweep_.search_limit_, max_k)
+                            : max_k;
+    auto thread_number = numerical_algorithm::ActualThreadNumber(
+        search_number, sweep_.thread_number_);
+    int batch_size =
+        sweep_.early_stop_ ? static_cast<int>(thread_number) : search_number;
+    std::vector<SweepWorkspace> workspaces(thread_number);
+    numerical_algorithm::FrequencyFiltering frequency_filter;
+    if (sweep_.engine_ == SweepEngine::frequency_domain)
     {
-        power_ratio[i] =
-            std::accumulate(filtered_displacement[i].begin(),
-                            filtered_displacement[i].end(),
-                            0.0,
-                            [](double x, double y) { return x + y * y; })
-            / std::accumulate(filtered_displacement[i - 1].begin(),
-                              filtered_displacement[i - 1].end(),
-                              0.0,
-                              [](double x, double y) { return x + y * y; });
+        frequency_filter.SetSignal(acceleration);
     }
+    std::vector<double> power, power_ratio;
+    power.reserve(search_number);
+    power_ratio.reserve(search_number);
 
-    // 3.2 选择功率比最大的结果
-    int nth_fre, nth_fre_defalt = 30;
-    auto peaks = numerical_algorithm::FindPeaks(power_ratio);
-    if (peaks.size())
+    // 2.2 逐批计算功率和功率比，选择结果确定后提前终止
+    while (static_cast<int>(power.size()) < search_number)
     {
-        auto nfre_peak_index =
-            std::find_if(power_ratio.begin(),
-                         power_ratio.end(),
-                         [](const double &x) { return x > 0.9; });
-        if (nfre_peak_index == power_ratio.end())
+        int evaluated = static_cast<int>(power.size());
+        int batch = std::min(batch_size, search_number - evaluated);
+        power.resize(evaluated + batch, 0.0);
+        numerical_algorithm::ParallelFor(
+            batch,
+            [&](std::size_t i, std::size_t thread_index) {
+                auto &workspace = workspaces[thread_index];
+                int k = evaluated + static_cast<int>(i);
+                FilteringIntegralSingle(acceleration,
+                                        frequency_filter,
+                                        k,
+                                        workspace,
+                                        workspace.displacement);
+                power[k] = std::accumulate(
+                    workspace.displacement.begin(),
+                    workspace.displacement.end(),
+                    0.0,
+                    [](double x, double y) { return x + y * y; });
+            },
+            thread_number);
+
+        // 3.根据功率比选择最佳结果
+        // 3.1 更新功率比
+        for (int k = evaluated; k < evaluated + batch; ++k)
         {
-            nth_fre = nth_fre_defalt;
+            power_ratio.push_back(k == 0 ? power[0] / power_0
+                                         : power[k] / power[k - 1]);
         }
-        else
+        if (sweep_.early_stop_ && IsSelectionDecided(power_ratio))
         {
-            nth_fre = peaks[0];
+            break;
         }
     }
-    else
+
+    // 3.2 重新计算选中候选的位移
+    auto &workspace = workspaces.front();
+    std::vector<double> filtered_displacement;
+    FilteringIntegralSingle(acceleration,
+                            frequency_filter,
+                            SelectCandidate(power_ratio),
+                            workspace,
+                            filtered_displacement);
+    return filtered_displacement;
+}
+
+// 预先设计全部低频截止频率候选的滤波器
+void ModifiedFilteringIntegral::PrewarmDesignCache(
+    double sampling_frequency) const
+{
+    std::vector<std::pair<double, double>> bands;
+    bands.reserve(sweep_.candidate_number_);
+    for (int k = 0; k < sweep_.candidate_number_; ++k)
+    {
+        bands.push_back(CandidateBand(k, sampling_frequency));
+    }
+    numerical_algorithm::FilterDesignCache::Global().Prewarm(kSweepFilterOrder,
+                                                             bands);
+}
+
+// 指定候选的归一化截止频率
+std::pair<double, double>
+ModifiedFilteringIntegral::CandidateBand(int candidate,
+                                         double sampling_frequency) const
+{
+    double high = sweep_.high_frequency_ / sampling_frequency * 2;
+    double low_scale = high / 20;
+    double low = 1.0 * (candidate + 1) / sweep_.candidate_number_ * low_scale;
+    return {low, high};
+}
+
+// 从全局设计缓存中获取指定候选的滤波器设计
+std::shared_ptr<const numerical_algorithm::ButterworthFilterDesign>
+ModifiedFilteringIntegral::DesignCandidateFilter(int candidate) const
+{
+    auto band = CandidateBand(candidate, input_acceleration_.get_frequency());
+    return numerical_algorithm::FilterDesignCache::Global().Get(
+        kSweepFilterOrder, band.first, band.second);
+}
+
+// 指定低频截止频率下的滤波积分
+void ModifiedFilteringIntegral::FilteringIntegralSingle(
+    const std::vector<double> &acceleration,
+    const numerical_algorithm::FrequencyFiltering &frequency_filter,
+    int candidate,
+    SweepWorkspace &workspace,
+    std::vector<double> &displacement) const
+{
+    // 1.设置滤波参数
+    double dt = input_acceleration_.get_time_step();
+    workspace.filter_design = DesignCandidateFilter(candidate);
+
+    // 2.频域方式：三次零相位滤波合并为|H|^6，与两次积分一起施加到频谱上
+    if (sweep_.engine_ == SweepEngine::frequency_domain)
+    {
+        workspace.filter_design->get_filter_coefficients(
+            workspace.coefficients_a, workspace.coefficients_b);
+        frequency_filter.ZeroPhaseResponse(workspace.coefficients_a,
+                                           workspace.coefficients_b,
+                                           workspace.response);
+        for (auto &value : workspace.response)
+        {
+            value = value * value * value;
+        }
+        frequency_filter.ApplyResponse(workspace.response,
+                                       displacement,
+                                       workspace.spectrum_workspace,
+                                       2,
+                                       dt);
+        return;
+    }
+
+    // 3.时域方式：滤波积分，中间结果在两个缓冲区之间交替
+    workspace.filter_function.set_filter_structure(method_.filter_structure_);
+    workspace.filter_function.set_coefficients(*workspace.filter_design);
+    workspace.filter_function.Filtering(acceleration, workspace.buffer_a);
+    numerical_algorithm::Cumtrapz(workspace.buffer_a, dt, workspace.buffer_b);
+    workspace.filter_function.Filtering(workspace.buffer_b, workspace.buffer_a);
+    numerical_algorithm::Cumtrapz(workspace.buffer_a, dt, workspace.buffer_b);
+    workspace.filter_function.Filtering(workspace.buffer_b, displacement);
+}
+
+// 判断已计算的功率比序列是否已经能够确定选择结果
+bool ModifiedFilteringIntegral::IsSelectionDecided(
+    const std::vector<double> &power_ratio) const
+{
+    // 第一个峰值已经出现且已有功率比超过阈值时，后续候选不会改变选择结果
+    double threshold = sweep_.power_ratio_threshold_;
+    return power_ratio.size() > 2
+           && !numerical_algorithm::FindPeaks(power_ratio).empty()
+           && std::any_of(power_ratio.begin(),
+                          power_ratio.end(),
+                          [threshold](const double &x) { return x > threshold; });
+}
+
+// 根据功率比选择低频截止频率候选
+int ModifiedFilteringIntegral::SelectCandidate(
+    const std::vector<double> &power_ratio) const
+{
+    // 选择第一个功率比峰值；若无峰值或功率比均未超过阈值，采用默认候选
+    double threshold = sweep_.power_ratio_threshold_;
+    auto peaks = numerical_algorithm::FindPeaks(power_ratio);
+    if (peaks.empty()
+        || std::none_of(power_ratio.begin(),
+                        power_ratio.end(),
+                        [threshold](const double &x) { return x > threshold; }))
     {
-        nth_fre = nth_fre_defalt;
+        return sweep_.default_candidate_;
     }
-    return filtered_displacement[nth_fre];
+    return static_cast<int>(peaks.front());
 }
 } // namespace edp_calculation
\ No newline at end of file
@@ -24,6 +24,7 @@
 
 // stdc++ headers
 #include <memory>
+#include <utility>
 #include <vector>
 
 // third-party library headers
@@ -31,6 +32,8 @@
 // project headers
 #include "data_structure/acceleration.h"
 #include "data_structure/building.h"
+#include "numerical_algorithm/butterworth_filter_design.h"
+#include "numerical_algorithm/frequency_filtering.h"
 
 #include "basic_edp_calculation.h"
 #include "filtering_integral.h"
@@ -39,6 +42,36 @@
 namespace edp_calculation
 {
 
+// 低频截止频率扫描的计算方式
+enum class SweepEngine
+{
+    // 时域filtfilt滤波和梯形积分
+    time_domain,
+    // 频域零相位滤波和积分：每列一次正向FFT，每个候选一次逆FFT
+    frequency_domain
+};
+
+// 改进的滤波积分插值法中低频截止频率扫描的参数结构体
+struct LowCutSweepParameter
+{
+    // 低频截止频率候选数量，第k个候选的低频截止频率为(k+1)/candidate_number_倍的扫描上限
+    int candidate_number_{100};
+    // 功率比未出现峰值或未超过阈值时采用的候选序号
+    int default_candidate_{30};
+    // 功率比阈值
+    double power_ratio_threshold_{0.9};
+    // 高频截止频率(Hz)，低频截止频率的扫描上限为其1/20
+    double high_frequency_{20};
+    // 扫描使用的线程数量，0表示使用硬件线程数
+    std::size_t thread_number_{0};
+    // 是否提前终止：按截止频率递增的顺序逐批计算候选，选择结果确定后即停止
+    bool early_stop_{true};
+    // 最多计算的候选数量，0表示不限制（即candidate_number_）
+    int search_limit_{0};
+    // 扫描的计算方式
+    SweepEngine engine_{SweepEngine::time_domain};
+}; // struct LowCutSweepParameter
+
 // 滤波积分插值法计算工程需求参量的类
 class ModifiedFilteringIntegral : public BasicEdpCalculation
 {
@@ -47,22 +80,24 @@ public:
     ModifiedFilteringIntegral() = default;
 
     // 从配置文件中读取参数构造
-    // @param acceleration 加速度数据
+    // @param acceleration 加速度数据或加速度视图
     // @param building 建筑结构信息
-    ModifiedFilteringIntegral(const data_structure::Acceleration &acceleration,
-                              data_structure::Building &building)
+    ModifiedFilteringIntegral(
+        const data_structure::AccelerationView &acceleration,
+        data_structure::Building &building)
         : BasicEdpCalculation(acceleration, building)
     {
         LoadConfig();
     }
 
     // 从加速度数据中构造，默认使用巴特沃斯滤波器，零相位双向滤波，带通滤波
-    // @param acceleration 加速度数据
+    // @param acceleration 加速度数据或加速度视图
     // @param building 建筑结构信息
     // @param filter_order 滤波器阶数
-    ModifiedFilteringIntegral(const data_structure::Acceleration &acceleration,
-                              data_structure::Building &building,
-                              int filter_order)
+    ModifiedFilteringIntegral(
+        const data_structure::AccelerationView &acceleration,
+        data_structure::Building &building,
+        int filter_order)
         : BasicEdpCalculation(acceleration, building)
     {
         method_.filter_order_ = filter_order;
@@ -99,6 +134,15 @@ public:
     // @return 滤波积分插值法计算方法参数的引用
     FilteringIntegralMethod &get_filtering_interp_method() { return method_; }
 
+    // 获取低频截止频率扫描参数
+    // @return 低频截止频率扫描参数的引用
+    LowCutSweepParameter &get_sweep_parameter() { return sweep_; }
+
+    // 预先设计指定采样频率下全部低频截止频率候选的滤波器，并存入全局设计缓存
+    // 处理同一台站的多个事件时，后续计算不再重复设计滤波器
+    // @param sampling_frequency 采样频率(Hz)
+    void PrewarmDesignCache(double sampling_frequency) const;
+
     // 滤波积分插值法计算的入口
     void CalculateEdp() override;
 
@@ -109,11 +153,52 @@ public:
 private:
     // 滤波积分插值法计算方法参数
     FilteringIntegralMethod method_{};
+    // 低频截止频率扫描参数
+    LowCutSweepParameter sweep_{};
     // 计算结果
     InterStoryDriftResult result_{};
 
+    // 扫描线程私有的工作区，在各候选之间复用
+    struct SweepWorkspace;
+
     // 滤波积分插值法计算单列加速度
     std::vector<double> CalculateSingle(const std::size_t &col);
+
+    // 指定候选的归一化截止频率
+    // @param candidate 低频截止频率候选序号
+    // @param sampling_frequency 采样频率(Hz)
+    // @return （低频截止频率，高频截止频率）
+    std::pair<double, double> CandidateBand(int candidate,
+                                            double sampling_frequency) const;
+
+    // 从全局设计缓存中获取指定候选的滤波器设计
+    // @param candidate 低频截止频率候选序号
+    // @return 共享的滤波器设计
+    std::shared_ptr<const numerical_algorithm::ButterworthFilterDesign>
+    DesignCandidateFilter(int candidate) const;
+
+    // 指定低频截止频率下的滤波积分，得到滤波后的位移
+    // @param acceleration 单列加速度
+    // @param frequency_filter 频域方式下已设置该列加速度的频域滤波类
+    // @param candidate 低频截止频率候选序号
+    // @param workspace 线程私有的工作区
+    // @param displacement 滤波后的位移
+    void FilteringIntegralSingle(
+        const std::vector<double> &acceleration,
+        const numerical_algorithm::FrequencyFiltering &frequency_filter,
+        int candidate,
+        SweepWorkspace &workspace,
+        std::vector<double> &displacement) const;
+
+    // 根据功率比序列选择低频截止频率候选
+    // @param power_ratio 功率比序列
+    // @return 选中的候选序号
+    int SelectCandidate(const std::vector<double> &power_ratio) const;
+
+    // 判断已计算的功率比序列是否已经能够确定选择结果
+    // @param power_ratio 已计算的功率比序列（按截止频率递增）
+    // @return 后续候选不会再改变选择结果时返回true
+    bool IsSelectionDecided(const std::vector<double> &power_ratio) const;
 };
 } // namespace edp_calculation
 
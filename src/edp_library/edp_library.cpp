@@ -33,6 +33,18 @@
 #include "edp_calculation/basic_edp_calculation.h"
 #include "edp_calculation/filtering_integral.h"
 #include "edp_calculation/modified_filtering_integral.h"
+#include "numerical_algorithm/scratch_arena.h"
+
+
+namespace
+{
+// 线程私有的临时内存池，各次计算的临时向量从中分配，计算结束时一次释放
+numerical_algorithm::ScratchArena &EventArena()
+{
+    thread_local numerical_algorithm::ScratchArena arena;
+    return arena;
+}
+} // namespace
 
 // 滤波积分方法计算层间位移角
 Idr *FilteringIntegral(const double *input_acceleration,
@@ -40,6 +52,8 @@ Idr *FilteringIntegral(const double *input_acceleration,
                        double frequency,
                        Building *building)
 {
+    numerical_algorithm::ScratchScope scope(EventArena());
+
     /// 创建加速度计算对象
     auto acceleration = data_structure::Acceleration(
         std::vector<std::vector<double>>(building->measure_point_count,
@@ -48,9 +62,9 @@ Idr *FilteringIntegral(const double *input_acceleration,
         0.01);
     for (std::size_t i = 0; i < building->measure_point_count; ++i)
     {
-        acceleration.data()[i].assign(input_acceleration + i * time_step_count,
-                                      input_acceleration
-                                          + (i + 1) * time_step_count);
+        std::copy(input_acceleration + i * time_step_count,
+                  input_acceleration + (i + 1) * time_step_count,
+                  acceleration.col(i).begin());
     }
 
     // 创建建筑信息计算对象
@@ -88,6 +102,8 @@ Idr *ModifiedFilteringIntegral(const double *input_acceleration,
                                double frequency,
                                Building *building)
 {
+    numerical_algorithm::ScratchScope scope(EventArena());
+
     // 创建加速度计算对象
     auto acceleration = data_structure::Acceleration(
         std::vector<std::vector<double>>(building->measure_point_count,
@@ -96,9 +112,9 @@ Idr *ModifiedFilteringIntegral(const double *input_acceleration,
         0.01);
     for (std::size_t i = 0; i < building->measure_point_count; ++i)
     {
-        acceleration.data()[i].assign(input_acceleration + i * time_step_count,
-                                      input_acceleration
-                                          + (i + 1) * time_step_count);
+        std::copy(input_acceleration + i * time_step_count,
+                  input_acceleration + (i + 1) * time_step_count,
+                  acceleration.col(i).begin());
     }
 
     // 创建建筑信息计算对象
@@ -22,6 +22,7 @@
 #include "edp_plot.h"
 
 // stdc++ headers
+#include <algorithm>
 #include <vector>
 
 // project headers
@@ -44,9 +45,9 @@ void PlotMaxIdr(const double *input_acceleration,
         0.01);
     for (std::size_t i = 0; i < building->measure_point_count; ++i)
     {
-        acceleration.data()[i].assign(input_acceleration + i * time_step_count,
-                                      input_acceleration
-                                          + (i + 1) * time_step_count);
+        std::copy(input_acceleration + i * time_step_count,
+                  input_acceleration + (i + 1) * time_step_count,
+                  acceleration.col(i).begin());
     }
 
     // 创建建筑信息计算对象
@@ -22,6 +22,7 @@
 #include "gmp_calculation.h"
 
 // stdc++ headers
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <vector>
@@ -30,6 +31,7 @@
 #include "nlohmann/json.hpp"
 
 // project headers
+#include "numerical_algorithm/parallel.h"
 #include "numerical_algorithm/vector_calculation.h"
 
 namespace gmp_calculation
@@ -68,41 +70,145 @@ GmpCalculation::GmpCalculation(const std::vector<double> &acceleration)
 // NewmakeBeta方法计算响应
 ResponseSpectrumTiResult GmpCalculation::NewmarkBeta(const double &Ti)
 {
-    double dt = parameter_.time_step_;
-    double beta = 0.25, gamma = 0.5;
-    double omega = 2 * M_PI / Ti;
-    double k = omega * omega, c = 2 * parameter_.damping_ratio_ * omega;
-    double p1 = 1 / (beta * dt * dt);
-    double p2 = gamma / (beta * dt);
-    double p3 = 1 / (beta * dt);
-    double p4 = gamma / beta - 1;
-    double p5 = 1 / (2 * beta) - 1;
-    double p6 = dt * (gamma / 2 / beta - 1);
-    double a1 = p1 + p2 * c, a2 = p3 + p4 * c, a3 = p5 + p6 * c;
-    double k_b = k + a1;
-    // 初始化
-    std::vector<double> u(acceleration_ptr_->size()),
-        v(acceleration_ptr_->size()), a(acceleration_ptr_->size()),
-        a_(acceleration_ptr_->size());
-    double p = -acceleration_ptr_->at(0);
-    u[0] = 0;
-    v[0] = 0;
-    a[0] = p;
-    // 迭代
-    for (size_t i = 1; i != acceleration_ptr_->size(); i++)
+    auto peak = NewmarkBetaPeakResponse(acceleration_ptr_->data(),
+                                        acceleration_ptr_->size(),
+                                        Ti,
+                                        parameter_.damping_ratio_,
+                                        parameter_.time_step_);
+    response_spectrum_ti_.SaTi = peak.acceleration_;
+    response_spectrum_ti_.SvTi = peak.velocity_;
+    response_spectrum_ti_.SdTi = peak.displacement_;
+    return response_spectrum_ti_;
+}
+
+// 分段线性精确解法计算响应
+ResponseSpectrumTiResult GmpCalculation::PiecewiseLinear(const double &Ti)
+{
+    PiecewiseLinearCoefficients coefficients(
+        Ti, parameter_.damping_ratio_, parameter_.time_step_);
+    auto peak = PiecewiseLinearPeakResponse(
+        acceleration_ptr_->data(), acceleration_ptr_->size(), coefficients);
+    response_spectrum_ti_.SaTi = peak.acceleration_;
+    response_spectrum_ti_.SvTi = peak.velocity_;
+    response_spectrum_ti_.SdTi = peak.displacement_;
+    return response_spectrum_ti_;
+}
+
+// 按设置的求解方法计算Ti周期下的响应
+ResponseSpectrumTiResult GmpCalculation::SdofResponse(const double &Ti)
+{
+    switch (parameter_.response_spectrum_solver_)
     {
-        p = -acceleration_ptr_->at(i) + a1 * u[i - 1] + a2 * v[i - 1]
-            + a3 * a[i - 1];
-        u[i] = p / k_b;
-        v[i] = p2 * (u[i] - u[i - 1]) - p4 * v[i - 1] - p6 * a[i - 1];
-        a[i] = p1 * (u[i] - u[i - 1]) - p3 * v[i - 1] - p5 * a[i - 1];
-        a_[i] = a[i] + acceleration_ptr_->at(i);
+        case ResponseSpectrumSolver::piecewise_linear:
+            return PiecewiseLinear(Ti);
+        case ResponseSpectrumSolver::newmark_beta:
+        default:
+            return NewmarkBeta(Ti);
     }
-    // 计算结果
-    response_spectrum_ti_.SaTi = numerical_algorithm::FindMaxAbs(a_);
-    response_spectrum_ti_.SvTi = numerical_algorithm::FindMaxAbs(v);
-    response_spectrum_ti_.SdTi = numerical_algorithm::FindMaxAbs(u);
-    return response_spectrum_ti_;
+}
+
+// 分段线性精确解法计算整条反应谱
+void GmpCalculation::PiecewiseLinearResponseSpectrum(
+    const std::vector<double> &periods)
+{
+    std::vector<PiecewiseLinearCoefficients> coefficients;
+    coefficients.reserve(periods.size());
+    for (auto Ti : periods)
+    {
+        coefficients.emplace_back(
+            Ti, parameter_.damping_ratio_, parameter_.time_step_);
+    }
+    auto peaks =
+        PiecewiseLinearSpectrum(acceleration_ptr_->data(),
+                                acceleration_ptr_->size(),
+                                coefficients,
+                                parameter_.response_spectrum_thread_number_);
+    for (const auto &peak : peaks)
+    {
+        response_spectrum_.Sa.push_back(peak.acceleration_);
+        response_spectrum_.Sv.push_back(peak.velocity_);
+        response_spectrum_.Sd.push_back(peak.displacement_);
+    }
+}
+
+// 获取按当前设置生成的反应谱横轴周期
+std::vector<double> GmpCalculation::ResponseSpectrumPeriods() const
+{
+    switch (parameter_.response_spectrum_period_grid_)
+    {
+        case PeriodGrid::logarithmic:
+            return LogarithmicPeriods(
+                parameter_.response_spectrum_min_period_,
+                parameter_.response_spectrum_max_period_,
+                parameter_.response_spectrum_period_number_);
+        case PeriodGrid::custom:
+            return parameter_.response_spectrum_periods_;
+        case PeriodGrid::uniform:
+        default:
+            return UniformPeriods(parameter_.response_spectrum_dt_,
+                                  parameter_.response_spectrum_max_period_);
+    }
+}
+
+// 一次计算多个阻尼比的反应谱
+ResponseSpectrumSurface GmpCalculation::MultiDampingResponseSpectrum(
+    const std::vector<double> &damping_ratios)
+{
+    ResponseSpectrumSurface surface;
+    surface.damping_ratios = damping_ratios;
+    surface.periods = ResponseSpectrumPeriods();
+    const auto &acceleration = *acceleration_ptr_;
+    std::size_t period_number = surface.periods.size();
+    std::vector<SdofPeakResponse> peaks;
+
+    if (parameter_.response_spectrum_solver_
+        == ResponseSpectrumSolver::piecewise_linear)
+    {
+        // 1.所有（阻尼比，周期）的系数按行排列，一次分批同步递推
+        std::vector<PiecewiseLinearCoefficients> coefficients;
+        coefficients.reserve(damping_ratios.size() * period_number);
+        for (auto damping_ratio : damping_ratios)
+        {
+            for (auto period : surface.periods)
+            {
+                coefficients.emplace_back(
+                    period, damping_ratio, parameter_.time_step_);
+            }
+        }
+        peaks = PiecewiseLinearSpectrum(
+            acceleration.data(),
+            acceleration.size(),
+            coefficients,
+            parameter_.response_spectrum_thread_number_);
+    }
+    else
+    {
+        // 1.Newmark-β法的各（阻尼比，周期）在多个线程中逐个计算
+        peaks.resize(damping_ratios.size() * period_number);
+        numerical_algorithm::ParallelFor(
+            peaks.size(),
+            [&](std::size_t k, std::size_t) {
+                peaks[k] = NewmarkBetaPeakResponse(
+                    acceleration.data(),
+                    acceleration.size(),
+                    surface.periods[k % period_number],
+                    damping_ratios[k / period_number],
+                    parameter_.time_step_);
+            },
+            parameter_.response_spectrum_thread_number_);
+    }
+
+    // 2.写入结果
+    surface.Sa.reserve(peaks.size());
+    surface.Sv.reserve(peaks.size());
+    surface.Sd.reserve(peaks.size());
+    for (const auto &peak : peaks)
+    {
+        surface.Sa.push_back(peak.acceleration_);
+        surface.Sv.push_back(peak.velocity_);
+        surface.Sd.push_back(peak.displacement_);
+    }
+    return surface;
 }
 
 // 从配置文件中读取参数
@@ -133,6 +239,25 @@ void GmpCalculation::LoadConfig(const std::string &config_file)
         config["ResponseSpectrumConfig"]["period_step"];
     parameter_.response_spectrum_max_period_ =
         config["ResponseSpectrumConfig"]["max_period"];
+    parameter_.response_spectrum_period_grid_ =
+        config["ResponseSpectrumConfig"].value(
+            "period_grid", parameter_.response_spectrum_period_grid_);
+    parameter_.response_spectrum_min_period_ =
+        config["ResponseSpectrumConfig"].value(
+            "min_period", parameter_.response_spectrum_min_period_);
+    parameter_.response_spectrum_period_number_ =
+        config["ResponseSpectrumConfig"].value(
+            "period_number", parameter_.response_spectrum_period_number_);
+    parameter_.response_spectrum_periods_ =
+        config["ResponseSpectrumConfig"].value(
+            "periods", parameter_.response_spectrum_periods_);
+    CheckPeriods(parameter_.response_spectrum_periods_);
+    parameter_.response_spectrum_solver_ =
+        config["ResponseSpectrumConfig"].value(
+            "solver", parameter_.response_spectrum_solver_);
+    parameter_.response_spectrum_thread_number_ =
+        config["ResponseSpectrumConfig"].value(
+            "thread_number", parameter_.response_spectrum_thread_number_);
     parameter_.fourier_spectrum_max_frequency_ =
         config["FourierConfig"]["max_frequency"];
 }
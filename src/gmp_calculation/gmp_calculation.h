@@ -19,7 +19,7 @@
 // 计算地震参数的类。
 // 已经完成了各种反应谱、持时（95%）、峰值信息、Fourier变换等计算。
 // TODO: Arias强度、Housner强度、能量密度谱等计算有待加入。
-// TODO: 反应谱的横轴最大值、步长的设置有待加入。
+// 反应谱横轴周期可为等间隔分布、对数分布或自定义周期。
 
 #ifndef GMP_CALCULATION_GMP_CACULATION_H
 #define GMP_CALCULATION_GMP_CACULATION_H
@@ -31,20 +31,20 @@
 #include <complex>
 #include <memory>
 #include <numeric>
+#include <stdexcept>
 #include <vector>
 
-
-// third-party headers
-#include "fftw3.h"
-
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
 // project headers
 #include <cstdlib>
+#include "numerical_algorithm/fft_plan_cache.h"
 #include "numerical_algorithm/integral.h"
 #include "numerical_algorithm/vector_calculation.h"
+#include "period_grid.h"
+#include "response_spectrum_solver.h"
 
 
 namespace gmp_calculation
@@ -58,10 +58,23 @@ struct GmpCalculationParameter
     double time_step_ = 1.0 / frequency_;
     // 阻尼比
     double damping_ratio_ = 0.05;
-    // 反应谱横轴周期的步长
+    // 反应谱的求解方法
+    ResponseSpectrumSolver response_spectrum_solver_ =
+        ResponseSpectrumSolver::newmark_beta;
+    // 分段线性精确解法计算整条反应谱的线程数，0表示使用硬件线程数
+    std::size_t response_spectrum_thread_number_ = 0;
+    // 反应谱横轴周期的分布方式
+    PeriodGrid response_spectrum_period_grid_ = PeriodGrid::uniform;
+    // 反应谱横轴周期的步长（等间隔分布）
     double response_spectrum_dt_ = 0.01;
-    // 反应谱横轴最大周期
+    // 反应谱横轴最小周期（对数分布）
+    double response_spectrum_min_period_ = 0.01;
+    // 反应谱横轴最大周期（等间隔分布和对数分布）
     double response_spectrum_max_period_ = 5;
+    // 反应谱横轴周期数（对数分布）
+    std::size_t response_spectrum_period_number_ = 100;
+    // 自定义的反应谱横轴周期
+    std::vector<double> response_spectrum_periods_{};
     // Fourier横轴频率间隔（无需设置，仅作读取用）
     double fourier_spectrum_df_ = 0;
     // Fourier谱横轴最大频率，0表示不限制
@@ -74,6 +87,36 @@ struct ResponseSpectrumResult
     std::vector<double> Sa{};
     std::vector<double> Sv{};
     std::vector<double> Sd{};
+    // 各谱值对应的周期
+    std::vector<double> periods{};
+};
+
+// 多个阻尼比的地震反应谱计算结果，谱值按阻尼比逐行、周期逐列连续存储
+struct ResponseSpectrumSurface
+{
+    // 阻尼比
+    std::vector<double> damping_ratios{};
+    // 周期
+    std::vector<double> periods{};
+    // 第i个阻尼比、第j个周期的谱值位于[i * periods.size() + j]
+    std::vector<double> Sa{};
+    std::vector<double> Sv{};
+    std::vector<double> Sd{};
+
+    // 获取一个阻尼比的反应谱
+    // @param damping_index 阻尼比的序号
+    // @return 该阻尼比的反应谱
+    ResponseSpectrumResult at(std::size_t damping_index) const
+    {
+        if (damping_index >= damping_ratios.size())
+            throw std::out_of_range("The damping index is out of range.");
+        auto begin = damping_index * periods.size();
+        auto end = begin + periods.size();
+        return {{Sa.begin() + begin, Sa.begin() + end},
+                {Sv.begin() + begin, Sv.begin() + end},
+                {Sd.begin() + begin, Sd.begin() + end},
+                periods};
+    }
 };
 
 // Ti周期下地震反应谱计算结果
@@ -152,6 +195,16 @@ private:
     // NewmakeBeta方法计算响应
     struct ResponseSpectrumTiResult NewmarkBeta(const double &Ti);
 
+    // 分段线性精确解法计算响应
+    ResponseSpectrumTiResult PiecewiseLinear(const double &Ti);
+
+    // 按设置的求解方法计算Ti周期下的响应
+    ResponseSpectrumTiResult SdofResponse(const double &Ti);
+
+    // 分段线性精确解法计算整条反应谱，各周期分批同步递推并多线程计算
+    // @param periods 周期
+    void PiecewiseLinearResponseSpectrum(const std::vector<double> &periods);
+
     // 计算Fourier变换
     inline void fourier_transform();
 
@@ -173,6 +226,39 @@ public:
     // @param damping_ratio 阻尼比
     inline void set_damping_ratio(double damping_ratio);
 
+    // 设置反应谱的求解方法
+    // @param solver 求解方法
+    inline void set_response_spectrum_solver(ResponseSpectrumSolver solver);
+
+    // 设置分段线性精确解法计算整条反应谱的线程数
+    // @param thread_number 线程数，0表示使用硬件线程数
+    inline void set_response_spectrum_thread_number(std::size_t thread_number)
+    {
+        parameter_.response_spectrum_thread_number_ = thread_number;
+    }
+
+    // 设置等间隔分布的反应谱横轴周期：step, 2 * step, ...，不超过最大周期
+    // @param period_step 周期步长
+    // @param max_period 最大周期
+    inline void set_uniform_periods(double period_step, double max_period);
+
+    // 设置对数分布的反应谱横轴周期
+    // @param min_period 最小周期
+    // @param max_period 最大周期
+    // @param period_number 周期数
+    inline void set_logarithmic_periods(double min_period,
+                                        double max_period,
+                                        std::size_t period_number);
+
+    // 设置自定义的反应谱横轴周期
+    // @param periods 周期，须为正
+    inline void
+    set_response_spectrum_periods(const std::vector<double> &periods);
+
+    // 获取按当前设置生成的反应谱横轴周期
+    // @return 周期
+    std::vector<double> ResponseSpectrumPeriods() const;
+
     // 从配置文件中读取参数
     // @param config_file 配置文件路径
     void LoadConfig(const std::string &config_file = "config/GMP_Config.json");
@@ -257,6 +343,13 @@ public:
     // 获取反应谱
     inline ResponseSpectrumResult ResponseSpectrum();
 
+    // 一次计算多个阻尼比的反应谱，所有（阻尼比，周期）在同一次遍历中计算，
+    // 周期按当前设置生成，求解方法按设置选择；不改变已有计算结果
+    // @param damping_ratios 阻尼比
+    // @return 多个阻尼比的反应谱
+    ResponseSpectrumSurface
+    MultiDampingResponseSpectrum(const std::vector<double> &damping_ratios);
+
     // 获取加速度反应谱
     inline std::vector<double> AccelerationSpectrum();
 
@@ -321,6 +414,48 @@ inline void GmpCalculation::set_damping_ratio(double damping_ratio)
     clear_result();
 }
 
+// 设置反应谱的求解方法
+inline void
+GmpCalculation::set_response_spectrum_solver(ResponseSpectrumSolver solver)
+{
+    parameter_.response_spectrum_solver_ = solver;
+    clear_result();
+}
+
+// 设置等间隔分布的反应谱横轴周期
+inline void GmpCalculation::set_uniform_periods(double period_step,
+                                                double max_period)
+{
+    UniformPeriods(period_step, max_period);
+    parameter_.response_spectrum_period_grid_ = PeriodGrid::uniform;
+    parameter_.response_spectrum_dt_ = period_step;
+    parameter_.response_spectrum_max_period_ = max_period;
+    clear_result();
+}
+
+// 设置对数分布的反应谱横轴周期
+inline void GmpCalculation::set_logarithmic_periods(double min_period,
+                                                    double max_period,
+                                                    std::size_t period_number)
+{
+    LogarithmicPeriods(min_period, max_period, period_number);
+    parameter_.response_spectrum_period_grid_ = PeriodGrid::logarithmic;
+    parameter_.response_spectrum_min_period_ = min_period;
+    parameter_.response_spectrum_max_period_ = max_period;
+    parameter_.response_spectrum_period_number_ = period_number;
+    clear_result();
+}
+
+// 设置自定义的反应谱横轴周期
+inline void GmpCalculation::set_response_spectrum_periods(
+    const std::vector<double> &periods)
+{
+    CheckPeriods(periods);
+    parameter_.response_spectrum_period_grid_ = PeriodGrid::custom;
+    parameter_.response_spectrum_periods_ = periods;
+    clear_result();
+}
+
 // 获取加速度数据
 inline std::vector<double> &GmpCalculation::get_acceleration()
 {
@@ -470,36 +605,42 @@ inline double GmpCalculation::Duration()
 inline ResponseSpectrumTiResult
 GmpCalculation::ResponseSpectrumTi(const double &Ti)
 {
-    return NewmarkBeta(Ti);
+    return SdofResponse(Ti);
 }
 
 // 获取Ti周期下加速度反应谱谱值
 inline double GmpCalculation::AccelerationSpectrumTi(const double &Ti)
 {
-    return NewmarkBeta(Ti).SaTi;
+    return SdofResponse(Ti).SaTi;
 }
 
 // 获取Ti周期下速度反应谱谱值
 inline double GmpCalculation::VelocitySpectrumTi(const double &Ti)
 {
-    return NewmarkBeta(Ti).SvTi;
+    return SdofResponse(Ti).SvTi;
 }
 
 // 获取Ti周期下位移反应谱谱值
 inline double GmpCalculation::DisplacementSpectrumTi(const double &Ti)
 {
-    return NewmarkBeta(Ti).SdTi;
+    return SdofResponse(Ti).SdTi;
 }
 
 // 获取反应谱
 inline ResponseSpectrumResult GmpCalculation::ResponseSpectrum()
 {
     clear_result();
-    int period_length = parameter_.response_spectrum_max_period_
-                        / parameter_.response_spectrum_dt_;
-    for (int Ti = 1; Ti <= period_length; ++Ti)
+    response_spectrum_.periods = ResponseSpectrumPeriods();
+    if (parameter_.response_spectrum_solver_
+        == ResponseSpectrumSolver::piecewise_linear)
+    {
+        PiecewiseLinearResponseSpectrum(response_spectrum_.periods);
+        response_spectrum_flag_ = true;
+        return response_spectrum_;
+    }
+    for (auto Ti : response_spectrum_.periods)
     {
-        NewmarkBeta(Ti * parameter_.response_spectrum_dt_);
+        SdofResponse(Ti);
         response_spectrum_.Sa.push_back(response_spectrum_ti_.SaTi);
         response_spectrum_.Sv.push_back(response_spectrum_ti_.SvTi);
         response_spectrum_.Sd.push_back(response_spectrum_ti_.SdTi);
@@ -569,21 +710,20 @@ inline double GmpCalculation::PseudoVelocitySpectrumTi(const double &Ti)
 // 获取拟反应谱
 inline ResponseSpectrumResult GmpCalculation::PseudoResponseSpectrum()
 {
-    double period_length = parameter_.response_spectrum_max_period_
-                           / parameter_.response_spectrum_dt_;
-    double omega;
     if (!response_spectrum_flag_)
     {
         ResponseSpectrum();
     }
-    for (int Ti = 1; Ti <= period_length; ++Ti)
+    const auto &periods = response_spectrum_.periods;
+    pesudo_response_spectrum_.periods = periods;
+    for (std::size_t i = 0; i != periods.size(); ++i)
     {
-        omega = 2 * M_PI / Ti * parameter_.response_spectrum_dt_;
-        pesudo_response_spectrum_.Sa.push_back(response_spectrum_.Sd[Ti - 1]
+        double omega = 2 * M_PI / periods[i];
+        pesudo_response_spectrum_.Sa.push_back(response_spectrum_.Sd[i]
                                                * omega * omega);
-        pesudo_response_spectrum_.Sv.push_back(response_spectrum_.Sd[Ti - 1]
+        pesudo_response_spectrum_.Sv.push_back(response_spectrum_.Sd[i]
                                                * omega);
-        pesudo_response_spectrum_.Sd.push_back(response_spectrum_.Sd[Ti - 1]);
+        pesudo_response_spectrum_.Sd.push_back(response_spectrum_.Sd[i]);
     }
     pesudo_response_spectrum_flag_ = true;
     return pesudo_response_spectrum_;
@@ -706,14 +846,12 @@ inline void GmpCalculation::calculate_displacement()
 // 计算Fourier变换
 inline void GmpCalculation::fourier_transform()
 {
+    // 计划从全局缓存中获取，相同长度的记录不再重复规划
     fourier_transform_result_.resize(acceleration_ptr_->size());
-    fftw_plan plan = fftw_plan_dft_r2c_1d(
+    numerical_algorithm::FftPlanCache::Global().Forward(
         acceleration_ptr_->size(),
         acceleration_ptr_->data(),
-        reinterpret_cast<fftw_complex *>(fourier_transform_result_.data()),
-        FFTW_ESTIMATE);
-    fftw_execute(plan);
-    fftw_destroy_plan(plan);
+        fourier_transform_result_.data());
 
     parameter_.fourier_spectrum_df_ =
         parameter_.frequency_ / fourier_transform_result_.size();
@@ -727,9 +865,11 @@ inline void GmpCalculation::clear_result()
     response_spectrum_.Sa.clear();
     response_spectrum_.Sv.clear();
     response_spectrum_.Sd.clear();
+    response_spectrum_.periods.clear();
     pesudo_response_spectrum_.Sa.clear();
     pesudo_response_spectrum_.Sv.clear();
     pesudo_response_spectrum_.Sd.clear();
+    pesudo_response_spectrum_.periods.clear();
     response_spectrum_flag_ = false;
     pesudo_response_spectrum_flag_ = false;
     fourier_transform_result_.clear();
@@ -0,0 +1,88 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\gmp_calculation\period_grid.cpp
+** -----
+** File Created: Saturday, 17th October 2026 23:12:40
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 23:12:40
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 反应谱横轴周期生成的实现
+
+// associated header
+#include "period_grid.h"
+
+// stdc++ headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+
+namespace gmp_calculation
+{
+
+// 等间隔分布的周期
+std::vector<double> UniformPeriods(double period_step, double max_period)
+{
+    if (!(period_step > 0))
+        throw std::invalid_argument("The period step must be positive.");
+    // 周期数的计算方式与原有反应谱相同，保证结果不变
+    int period_length = max_period / period_step;
+    std::vector<double> periods;
+    periods.reserve(std::max(period_length, 0));
+    for (int Ti = 1; Ti <= period_length; ++Ti)
+    {
+        periods.push_back(Ti * period_step);
+    }
+    return periods;
+}
+
+// 对数分布的周期
+std::vector<double> LogarithmicPeriods(double min_period,
+                                       double max_period,
+                                       std::size_t period_number)
+{
+    if (!(min_period > 0) || !(max_period >= min_period))
+        throw std::invalid_argument(
+            "The periods must satisfy 0 < min_period <= max_period.");
+    if (period_number == 0 || (period_number == 1 && max_period > min_period))
+        throw std::invalid_argument(
+            "The period number is too small for the period range.");
+
+    std::vector<double> periods(period_number, min_period);
+    if (period_number == 1)
+    {
+        return periods;
+    }
+    double ratio = std::log(max_period / min_period) / (period_number - 1);
+    for (std::size_t i = 1; i + 1 < period_number; ++i)
+    {
+        periods[i] = min_period * std::exp(ratio * i);
+    }
+    periods.back() = max_period;
+    return periods;
+}
+
+// 检查自定义的周期
+void CheckPeriods(const std::vector<double> &periods)
+{
+    for (auto period : periods)
+    {
+        if (!(period > 0) || !std::isfinite(period))
+            throw std::invalid_argument(
+                "The periods must be positive and finite.");
+    }
+}
+
+} // namespace gmp_calculation
@@ -0,0 +1,67 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\gmp_calculation\period_grid.h
+** -----
+** File Created: Saturday, 17th October 2026 23:12:40
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 23:12:40
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 反应谱横轴周期的生成。
+// 反应谱在短周期段变化剧烈、长周期段变化平缓，等间隔周期在长周期段浪费大部分
+// 计算量而在短周期段采样不足；对数分布的周期在各周期段的相对分辨率相同，约100
+// 个周期即可得到工程上足够精确的反应谱。
+
+#ifndef GMP_CALCULATION_PERIOD_GRID_H_
+#define GMP_CALCULATION_PERIOD_GRID_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <vector>
+
+
+namespace gmp_calculation
+{
+
+// 反应谱横轴周期的分布方式
+enum class PeriodGrid
+{
+    // 等间隔分布
+    uniform,
+    // 对数分布
+    logarithmic,
+    // 自定义周期
+    custom
+};
+
+// 等间隔分布的周期：step, 2 * step, ...，不超过最大周期
+// @param period_step 周期步长，须为正
+// @param max_period 最大周期
+// @return 周期
+std::vector<double> UniformPeriods(double period_step, double max_period);
+
+// 对数分布的周期，首尾分别为最小周期和最大周期
+// @param min_period 最小周期，须为正
+// @param max_period 最大周期，须不小于最小周期
+// @param period_number 周期数，最小周期小于最大周期时须不少于2
+// @return 周期
+std::vector<double> LogarithmicPeriods(double min_period,
+                                       double max_period,
+                                       std::size_t period_number);
+
+// 检查自定义的周期，周期须为有限的正数
+// @param periods 周期
+void CheckPeriods(const std::vector<double> &periods);
+
+} // namespace gmp_calculation
+
+#endif // GMP_CALCULATION_PERIOD_GRID_H_
@@ -0,0 +1,410 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\gmp_calculation\response_spectrum_solver.cpp
+** -----
+** File Created: Saturday, 17th October 2026 20:47:15
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 20:47:15
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 单自由度体系反应谱求解方法的实现。
+// 递推系数见 Nigam N C, Jennings P C. Calculation of response spectra from
+// strong-motion earthquake records. BSSA, 1969, 59(2): 909-922.
+
+// associated header
+#include "response_spectrum_solver.h"
+
+// stdc++ headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+// project headers
+#include "numerical_algorithm/multichannel_filter.h"
+#include "numerical_algorithm/parallel.h"
+
+// x86-64平台使用AVX2/AVX-512实现，其他平台只使用标量实现
+#if defined(_M_X64) || defined(__x86_64__)
+#define GMP_CALCULATION_X86_SIMD
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define GMP_CALCULATION_TARGET_AVX2
+#define GMP_CALCULATION_TARGET_AVX512
+#else
+// 关闭乘加合并，保证与标量实现结果相同
+#define GMP_CALCULATION_TARGET_AVX2                                            \
+    __attribute__((target("avx2"), optimize("fp-contract=off")))
+#define GMP_CALCULATION_TARGET_AVX512                                          \
+    __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#endif
+#endif
+
+
+namespace gmp_calculation
+{
+
+namespace
+{
+
+// 一批周期的递推系数，同一系数的各周期连续存储，不足一批时其余通道系数为0
+struct CoefficientBatch
+{
+    double a11[kPeriodBatch], a12[kPeriodBatch];
+    double a21[kPeriodBatch], a22[kPeriodBatch];
+    double b11[kPeriodBatch], b12[kPeriodBatch];
+    double b21[kPeriodBatch], b22[kPeriodBatch];
+    double stiffness[kPeriodBatch], damping[kPeriodBatch];
+};
+
+// 一批周期的峰值响应
+struct PeakBatch
+{
+    double acceleration[kPeriodBatch];
+    double velocity[kPeriodBatch];
+    double displacement[kPeriodBatch];
+};
+
+// 标量实现：一批周期逐样本同步递推，运算顺序与PiecewiseLinearPeakResponse相同
+void PeakBatchScalar(const double *acceleration,
+                     std::size_t size,
+                     const CoefficientBatch &k,
+                     PeakBatch &peak)
+{
+    double u[kPeriodBatch] = {}, v[kPeriodBatch] = {};
+    for (std::size_t i = 1; i < size; ++i)
+    {
+        double x0 = acceleration[i - 1], x1 = acceleration[i];
+        for (std::size_t l = 0; l < kPeriodBatch; ++l)
+        {
+            double u_next = k.a11[l] * u[l] + k.a12[l] * v[l] + k.b11[l] * x0
+                            + k.b12[l] * x1;
+            double v_next = k.a21[l] * u[l] + k.a22[l] * v[l] + k.b21[l] * x0
+                            + k.b22[l] * x1;
+            u[l] = u_next;
+            v[l] = v_next;
+            peak.displacement[l] =
+                std::max(peak.displacement[l], std::abs(u[l]));
+            peak.velocity[l] = std::max(peak.velocity[l], std::abs(v[l]));
+            peak.acceleration[l] =
+                std::max(peak.acceleration[l],
+                         std::abs(k.stiffness[l] * u[l] + k.damping[l] * v[l]));
+        }
+    }
+}
+
+#ifdef GMP_CALCULATION_X86_SIMD
+
+// AVX2实现：一批周期分为V组、每组4个周期，多组交替计算以掩盖递推的延迟
+template <std::size_t V>
+GMP_CALCULATION_TARGET_AVX2 void PeakBatchAvx2(const double *acceleration,
+                                               std::size_t size,
+                                               const CoefficientBatch &k,
+                                               PeakBatch &peak)
+{
+    static_assert(4 * V == kPeriodBatch, "One batch must fill V vectors.");
+    const __m256d sign = _mm256_set1_pd(-0.0);
+    __m256d u[V], v[V], pu[V], pv[V], pa[V];
+    for (std::size_t g = 0; g < V; ++g)
+    {
+        u[g] = v[g] = pu[g] = pv[g] = pa[g] = _mm256_setzero_pd();
+    }
+    for (std::size_t i = 1; i < size; ++i)
+    {
+        __m256d x0 = _mm256_set1_pd(acceleration[i - 1]);
+        __m256d x1 = _mm256_set1_pd(acceleration[i]);
+        for (std::size_t g = 0; g < V; ++g)
+        {
+            std::size_t l = 4 * g;
+            __m256d u_next = _mm256_add_pd(
+                _mm256_add_pd(
+                    _mm256_add_pd(
+                        _mm256_mul_pd(_mm256_loadu_pd(k.a11 + l), u[g]),
+                        _mm256_mul_pd(_mm256_loadu_pd(k.a12 + l), v[g])),
+                    _mm256_mul_pd(_mm256_loadu_pd(k.b11 + l), x0)),
+                _mm256_mul_pd(_mm256_loadu_pd(k.b12 + l), x1));
+            __m256d v_next = _mm256_add_pd(
+                _mm256_add_pd(
+                    _mm256_add_pd(
+                        _mm256_mul_pd(_mm256_loadu_pd(k.a21 + l), u[g]),
+                        _mm256_mul_pd(_mm256_loadu_pd(k.a22 + l), v[g])),
+                    _mm256_mul_pd(_mm256_loadu_pd(k.b21 + l), x0)),
+                _mm256_mul_pd(_mm256_loadu_pd(k.b22 + l), x1));
+            u[g] = u_next;
+            v[g] = v_next;
+            __m256d a = _mm256_add_pd(
+                _mm256_mul_pd(_mm256_loadu_pd(k.stiffness + l), u[g]),
+                _mm256_mul_pd(_mm256_loadu_pd(k.damping + l), v[g]));
+            pu[g] = _mm256_max_pd(pu[g], _mm256_andnot_pd(sign, u[g]));
+            pv[g] = _mm256_max_pd(pv[g], _mm256_andnot_pd(sign, v[g]));
+            pa[g] = _mm256_max_pd(pa[g], _mm256_andnot_pd(sign, a));
+        }
+    }
+    for (std::size_t g = 0; g < V; ++g)
+    {
+        _mm256_storeu_pd(peak.displacement + 4 * g, pu[g]);
+        _mm256_storeu_pd(peak.velocity + 4 * g, pv[g]);
+        _mm256_storeu_pd(peak.acceleration + 4 * g, pa[g]);
+    }
+}
+
+// AVX-512实现：一批周期分为V组、每组8个周期
+template <std::size_t V>
+GMP_CALCULATION_TARGET_AVX512 void PeakBatchAvx512(const double *acceleration,
+                                                   std::size_t size,
+                                                   const CoefficientBatch &k,
+                                                   PeakBatch &peak)
+{
+    static_assert(8 * V == kPeriodBatch, "One batch must fill V vectors.");
+    __m512d u[V], v[V], pu[V], pv[V], pa[V];
+    for (std::size_t g = 0; g < V; ++g)
+    {
+        u[g] = v[g] = pu[g] = pv[g] = pa[g] = _mm512_setzero_pd();
+    }
+    for (std::size_t i = 1; i < size; ++i)
+    {
+        __m512d x0 = _mm512_set1_pd(acceleration[i - 1]);
+        __m512d x1 = _mm512_set1_pd(acceleration[i]);
+        for (std::size_t g = 0; g < V; ++g)
+        {
+            std::size_t l = 8 * g;
+            __m512d u_next = _mm512_add_pd(
+                _mm512_add_pd(
+                    _mm512_add_pd(
+                        _mm512_mul_pd(_mm512_loadu_pd(k.a11 + l), u[g]),
+                        _mm512_mul_pd(_mm512_loadu_pd(k.a12 + l), v[g])),
+                    _mm512_mul_pd(_mm512_loadu_pd(k.b11 + l), x0)),
+                _mm512_mul_pd(_mm512_loadu_pd(k.b12 + l), x1));
+            __m512d v_next = _mm512_add_pd(
+                _mm512_add_pd(
+                    _mm512_add_pd(
+                        _mm512_mul_pd(_mm512_loadu_pd(k.a21 + l), u[g]),
+                        _mm512_mul_pd(_mm512_loadu_pd(k.a22 + l), v[g])),
+                    _mm512_mul_pd(_mm512_loadu_pd(k.b21 + l), x0)),
+                _mm512_mul_pd(_mm512_loadu_pd(k.b22 + l), x1));
+            u[g] = u_next;
+            v[g] = v_next;
+            __m512d a = _mm512_add_pd(
+                _mm512_mul_pd(_mm512_loadu_pd(k.stiffness + l), u[g]),
+                _mm512_mul_pd(_mm512_loadu_pd(k.damping + l), v[g]));
+            pu[g] = _mm512_max_pd(pu[g], _mm512_abs_pd(u[g]));
+            pv[g] = _mm512_max_pd(pv[g], _mm512_abs_pd(v[g]));
+            pa[g] = _mm512_max_pd(pa[g], _mm512_abs_pd(a));
+        }
+    }
+    for (std::size_t g = 0; g < V; ++g)
+    {
+        _mm512_storeu_pd(peak.displacement + 8 * g, pu[g]);
+        _mm512_storeu_pd(peak.velocity + 8 * g, pv[g]);
+        _mm512_storeu_pd(peak.acceleration + 8 * g, pa[g]);
+    }
+}
+
+#endif // GMP_CALCULATION_X86_SIMD
+
+// 按CPU支持的指令集计算一批周期
+void PeakBatchDispatch(numerical_algorithm::SimdLevel level,
+                       const double *acceleration,
+                       std::size_t size,
+                       const CoefficientBatch &k,
+                       PeakBatch &peak)
+{
+#ifdef GMP_CALCULATION_X86_SIMD
+    if (level == numerical_algorithm::SimdLevel::avx512)
+    {
+        PeakBatchAvx512<kPeriodBatch / 8>(acceleration, size, k, peak);
+        return;
+    }
+    if (level == numerical_algorithm::SimdLevel::avx2)
+    {
+        PeakBatchAvx2<kPeriodBatch / 4>(acceleration, size, k, peak);
+        return;
+    }
+#endif
+    PeakBatchScalar(acceleration, size, k, peak);
+}
+
+} // namespace
+
+// Newmark-β法计算单自由度体系的峰值响应
+SdofPeakResponse NewmarkBetaPeakResponse(const double *acceleration,
+                                         std::size_t size,
+                                         double period,
+                                         double damping_ratio,
+                                         double time_step)
+{
+    SdofPeakResponse peak;
+    if (size == 0)
+    {
+        return peak;
+    }
+    const double pi = 3.14159265358979323846;
+    double dt = time_step;
+    double beta = 0.25, gamma = 0.5;
+    double omega = 2 * pi / period;
+    double k = omega * omega, c = 2 * damping_ratio * omega;
+    double p1 = 1 / (beta * dt * dt);
+    double p2 = gamma / (beta * dt);
+    double p3 = 1 / (beta * dt);
+    double p4 = gamma / beta - 1;
+    double p5 = 1 / (2 * beta) - 1;
+    double p6 = dt * (gamma / 2 / beta - 1);
+    double a1 = p1 + p2 * c, a2 = p3 + p4 * c, a3 = p5 + p6 * c;
+    double k_b = k + a1;
+    // 只保留上一步的状态，峰值在迭代中更新，不保存响应时程
+    double u = 0, v = 0, a = -acceleration[0];
+    for (std::size_t i = 1; i < size; ++i)
+    {
+        double p = -acceleration[i] + a1 * u + a2 * v + a3 * a;
+        double u_next = p / k_b;
+        double v_next = p2 * (u_next - u) - p4 * v - p6 * a;
+        double a_next = p1 * (u_next - u) - p3 * v - p5 * a;
+        u = u_next;
+        v = v_next;
+        a = a_next;
+        peak.displacement_ = std::max(peak.displacement_, std::abs(u));
+        peak.velocity_ = std::max(peak.velocity_, std::abs(v));
+        peak.acceleration_ =
+            std::max(peak.acceleration_, std::abs(a + acceleration[i]));
+    }
+    return peak;
+}
+
+// 由周期、阻尼比和时间步长计算递推系数
+PiecewiseLinearCoefficients::PiecewiseLinearCoefficients(double period,
+                                                         double damping_ratio,
+                                                         double time_step)
+{
+    if (!(period > 0) || !(time_step > 0))
+        throw std::invalid_argument(
+            "The period and time step must be positive.");
+    if (!(damping_ratio >= 0 && damping_ratio < 1))
+        throw std::invalid_argument("The damping ratio must be in [0, 1).");
+
+    const double pi = 3.14159265358979323846;
+    const double xi = damping_ratio, dt = time_step;
+    const double omega = 2 * pi / period;
+    const double root = std::sqrt(1 - xi * xi);
+    const double omega_d = omega * root;
+    const double e = std::exp(-xi * omega * dt);
+    const double s = std::sin(omega_d * dt), c = std::cos(omega_d * dt);
+    const double omega2 = omega * omega, omega3 = omega2 * omega;
+
+    // 1.状态转移矩阵
+    a11_ = e * (xi / root * s + c);
+    a12_ = e * s / omega_d;
+    a21_ = -omega / root * e * s;
+    a22_ = e * (c - xi / root * s);
+
+    // 2.激励矩阵
+    const double t1 = (2 * xi * xi - 1) / (omega2 * dt);
+    const double t2 = 2 * xi / (omega3 * dt);
+    const double velocity_term = omega_d * s + xi * omega * c;
+    const double decay_term = c - xi / root * s;
+    b11_ = e * ((t1 + xi / omega) * s / omega_d + (t2 + 1 / omega2) * c) - t2;
+    b12_ = -e * (t1 * s / omega_d + t2 * c) - 1 / omega2 + t2;
+    b21_ = e
+               * ((t1 + xi / omega) * decay_term
+                  - (t2 + 1 / omega2) * velocity_term)
+           + 1 / (omega2 * dt);
+    b22_ = -e * (t1 * decay_term - t2 * velocity_term) - 1 / (omega2 * dt);
+
+    stiffness_ = omega2;
+    damping_ = 2 * xi * omega;
+}
+
+// 分段线性精确解法计算单自由度体系的峰值响应
+SdofPeakResponse
+PiecewiseLinearPeakResponse(const double *acceleration,
+                            std::size_t size,
+                            const PiecewiseLinearCoefficients &coefficients)
+{
+    SdofPeakResponse peak;
+    if (size == 0)
+    {
+        return peak;
+    }
+    const auto &k = coefficients;
+    double u = 0, v = 0;
+    for (std::size_t i = 1; i < size; ++i)
+    {
+        double u_next = k.a11_ * u + k.a12_ * v + k.b11_ * acceleration[i - 1]
+                        + k.b12_ * acceleration[i];
+        double v_next = k.a21_ * u + k.a22_ * v + k.b21_ * acceleration[i - 1]
+                        + k.b22_ * acceleration[i];
+        u = u_next;
+        v = v_next;
+        peak.displacement_ = std::max(peak.displacement_, std::abs(u));
+        peak.velocity_ = std::max(peak.velocity_, std::abs(v));
+        peak.acceleration_ = std::max(peak.acceleration_,
+                                      std::abs(k.stiffness_ * u
+                                               + k.damping_ * v));
+    }
+    return peak;
+}
+
+// 分段线性精确解法计算一组周期的峰值响应
+std::vector<SdofPeakResponse> PiecewiseLinearSpectrum(
+    const double *acceleration,
+    std::size_t size,
+    const std::vector<PiecewiseLinearCoefficients> &coefficients,
+    std::size_t thread_number)
+{
+    std::vector<SdofPeakResponse> result(coefficients.size());
+    if (size == 0 || coefficients.empty())
+    {
+        return result;
+    }
+    auto level = numerical_algorithm::DetectSimdLevel();
+    std::size_t batch_number =
+        (coefficients.size() + kPeriodBatch - 1) / kPeriodBatch;
+
+    // 每个任务计算一批周期，只读一遍地面加速度
+    numerical_algorithm::ParallelFor(
+        batch_number,
+        [&](std::size_t batch, std::size_t) {
+            // 1.按系数分组排列本批的递推系数
+            std::size_t begin = batch * kPeriodBatch;
+            std::size_t count =
+                std::min(kPeriodBatch, coefficients.size() - begin);
+            CoefficientBatch k{};
+            for (std::size_t l = 0; l < count; ++l)
+            {
+                const auto &c = coefficients[begin + l];
+                k.a11[l] = c.a11_;
+                k.a12[l] = c.a12_;
+                k.a21[l] = c.a21_;
+                k.a22[l] = c.a22_;
+                k.b11[l] = c.b11_;
+                k.b12[l] = c.b12_;
+                k.b21[l] = c.b21_;
+                k.b22[l] = c.b22_;
+                k.stiffness[l] = c.stiffness_;
+                k.damping[l] = c.damping_;
+            }
+
+            // 2.同步递推并写回峰值
+            PeakBatch peak{};
+            PeakBatchDispatch(level, acceleration, size, k, peak);
+            for (std::size_t l = 0; l < count; ++l)
+            {
+                result[begin + l].acceleration_ = peak.acceleration[l];
+                result[begin + l].velocity_ = peak.velocity[l];
+                result[begin + l].displacement_ = peak.displacement[l];
+            }
+        },
+        thread_number);
+    return result;
+}
+
+} // namespace gmp_calculation
@@ -0,0 +1,126 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\gmp_calculation\response_spectrum_solver.h
+** -----
+** File Created: Saturday, 17th October 2026 20:47:15
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 20:47:15
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 单自由度体系反应谱的求解方法。
+// 分段线性精确解法（Nigam-Jennings）：假定地面加速度在每个时间步内线性变化，
+// 运动方程 u'' + 2ξωu' + ω²u = -ag 在时间步内有闭式解，状态 (u, v) 的递推为
+//   [u, v]_{i+1} = A [u, v]_i + B [ag_i, ag_{i+1}]
+// 2×2矩阵A、B只与周期、阻尼比和时间步长有关，对每个周期计算一次；递推中只保留
+// 当前状态并同时更新峰值，不保存响应时程。对分段线性激励结果是精确的，短周期
+// （周期接近时间步长）时比Newmark-β法准确。
+// 整条反应谱的各周期相互独立：PiecewiseLinearSpectrum把周期分成每批
+// kPeriodBatch个，一批周期在SIMD通道中同步递推，只读一遍地面加速度；各批在
+// 多个线程中并行计算。结果与逐个周期计算逐位相同。
+// 多个阻尼比的反应谱只是更多组互不相关的（阻尼比，周期）系数，同样放入一次
+// PiecewiseLinearSpectrum调用中，共用对地面加速度的读取和线程划分。
+
+#ifndef GMP_CALCULATION_RESPONSE_SPECTRUM_SOLVER_H_
+#define GMP_CALCULATION_RESPONSE_SPECTRUM_SOLVER_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <vector>
+
+
+namespace gmp_calculation
+{
+
+// 反应谱的求解方法
+enum class ResponseSpectrumSolver
+{
+    // Newmark-β法（平均加速度法）
+    newmark_beta,
+    // 分段线性精确解法（Nigam-Jennings）
+    piecewise_linear
+};
+
+// 单自由度体系的峰值响应
+struct SdofPeakResponse
+{
+    // 绝对加速度峰值
+    double acceleration_{};
+    // 相对速度峰值
+    double velocity_{};
+    // 相对位移峰值
+    double displacement_{};
+};
+
+// Newmark-β法（平均加速度法）计算单自由度体系的峰值响应，初始状态为静止
+// @param acceleration 地面加速度
+// @param size 地面加速度的长度
+// @param period 周期
+// @param damping_ratio 阻尼比
+// @param time_step 时间步长
+// @return 峰值响应
+SdofPeakResponse NewmarkBetaPeakResponse(const double *acceleration,
+                                         std::size_t size,
+                                         double period,
+                                         double damping_ratio,
+                                         double time_step);
+
+// 分段线性精确解法的递推系数
+struct PiecewiseLinearCoefficients
+{
+    // 状态转移矩阵A
+    double a11_{}, a12_{}, a21_{}, a22_{};
+    // 激励矩阵B
+    double b11_{}, b12_{}, b21_{}, b22_{};
+    // ω²和2ξω，绝对加速度为 -(ω²u + 2ξωv)
+    double stiffness_{}, damping_{};
+
+    // 默认构造函数
+    PiecewiseLinearCoefficients() = default;
+
+    // 由周期、阻尼比和时间步长计算递推系数
+    // @param period 周期，须为正
+    // @param damping_ratio 阻尼比，须在[0, 1)内
+    // @param time_step 时间步长，须为正
+    PiecewiseLinearCoefficients(double period,
+                                double damping_ratio,
+                                double time_step);
+};
+
+// 分段线性精确解法计算单自由度体系的峰值响应，初始状态为静止
+// @param acceleration 地面加速度
+// @param size 地面加速度的长度
+// @param coefficients 递推系数
+// @return 峰值响应
+SdofPeakResponse
+PiecewiseLinearPeakResponse(const double *acceleration,
+                            std::size_t size,
+                            const PiecewiseLinearCoefficients &coefficients);
+
+// 整条反应谱每批同步递推的周期数
+constexpr std::size_t kPeriodBatch = 16;
+
+// 分段线性精确解法计算一组周期的峰值响应，各周期分批在SIMD通道中同步递推，
+// 各批在多个线程中并行计算
+// @param acceleration 地面加速度
+// @param size 地面加速度的长度
+// @param coefficients 各周期的递推系数
+// @param thread_number 线程数，0表示使用硬件线程数
+// @return 各周期的峰值响应，与coefficients一一对应
+std::vector<SdofPeakResponse> PiecewiseLinearSpectrum(
+    const double *acceleration,
+    std::size_t size,
+    const std::vector<PiecewiseLinearCoefficients> &coefficients,
+    std::size_t thread_number = 0);
+
+} // namespace gmp_calculation
+
+#endif // GMP_CALCULATION_RESPONSE_SPECTRUM_SOLVER_H_
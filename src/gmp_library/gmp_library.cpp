@@ -23,10 +23,53 @@
 
 // stdc++ headers
 #include <algorithm>
+#include <exception>
 #include <vector>
 
 // projects headers
 #include "gmp_calculation/gmp_calculation.h"
+#include "numerical_algorithm/fft_plan_cache.h"
+
+namespace
+{
+
+// 复制反应谱计算结果到输出对象
+// @param response 反应谱计算结果
+// @param dt 反应谱横轴间隔，周期不是等间隔分布时为0
+// @return 输出对象
+ResponseSpectrum *
+CopyResponseSpectrum(const gmp_calculation::ResponseSpectrumResult &response,
+                     double dt)
+{
+    ResponseSpectrum *result = new ResponseSpectrum;
+
+    auto size = response.periods.size();
+    result->Sa = new double[size];
+    result->Sv = new double[size];
+    result->Sd = new double[size];
+    result->period = new double[size];
+    std::copy(response.Sa.begin(), response.Sa.end(), result->Sa);
+    std::copy(response.Sv.begin(), response.Sv.end(), result->Sv);
+    std::copy(response.Sd.begin(), response.Sd.end(), result->Sd);
+    std::copy(response.periods.begin(), response.periods.end(), result->period);
+
+    result->result_size = static_cast<int>(size);
+    result->dt = dt;
+
+    return result;
+}
+
+// 反应谱横轴间隔，周期不是等间隔分布时为0
+double PeriodStep(const gmp_calculation::GmpCalculation &gmp)
+{
+    const auto &parameter = gmp.get_parameter();
+    return parameter.response_spectrum_period_grid_
+                   == gmp_calculation::PeriodGrid::uniform
+               ? parameter.response_spectrum_dt_
+               : 0.0;
+}
+
+} // namespace
 
 // 计算反应谱
 ResponseSpectrum *GetResponseSpectrum(const double *acceleration,
@@ -40,19 +83,7 @@ ResponseSpectrum *GetResponseSpectrum(const double *acceleration,
     auto response = gmp.get_response_spectrum();
 
     // 创建输出对象
-    ResponseSpectrum *result = new ResponseSpectrum;
-
-    result->Sa = new double[500];
-    result->Sv = new double[500];
-    result->Sd = new double[500];
-    std::copy(response.Sa.begin(), response.Sa.end(), result->Sa);
-    std::copy(response.Sv.begin(), response.Sv.end(), result->Sv);
-    std::copy(response.Sd.begin(), response.Sd.end(), result->Sd);
-
-    result->result_size = 500;
-    result->dt = 0.01;
-
-    return result;
+    return CopyResponseSpectrum(response, PeriodStep(gmp));
 }
 
 // 计算拟反应谱
@@ -67,19 +98,117 @@ ResponseSpectrum *GetPseudoResponseSpectrum(const double *acceleration,
     auto response = gmp.get_pseudo_response_spectrum();
 
     // 创建输出对象
-    ResponseSpectrum *result = new ResponseSpectrum;
+    return CopyResponseSpectrum(response, PeriodStep(gmp));
+}
 
-    result->Sa = new double[500];
-    result->Sv = new double[500];
-    result->Sd = new double[500];
-    std::copy(response.Sa.begin(), response.Sa.end(), result->Sa);
-    std::copy(response.Sv.begin(), response.Sv.end(), result->Sv);
-    std::copy(response.Sd.begin(), response.Sd.end(), result->Sd);
+// 计算指定周期的反应谱
+ResponseSpectrum *GetResponseSpectrumAtPeriods(const double *acceleration,
+                                               int size,
+                                               double frequency,
+                                               double damping_ratio,
+                                               const double *period,
+                                               int period_size)
+{
+    // 异常不能跨过C接口，参数无效或计算失败时返回nullptr
+    if (acceleration == nullptr || size <= 0 || period == nullptr
+        || period_size <= 0)
+    {
+        return nullptr;
+    }
+    try
+    {
+        // 创建计算对象
+        std::vector<double> acc(acceleration, acceleration + size);
+        gmp_calculation::GmpCalculation gmp(acc, frequency, damping_ratio);
+        gmp.set_response_spectrum_periods(
+            std::vector<double>(period, period + period_size));
+        auto response = gmp.get_response_spectrum();
+
+        // 创建输出对象
+        return CopyResponseSpectrum(response, 0.0);
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
 
-    result->result_size = 500;
-    result->dt = 0.01;
+// 计算指定周期的拟反应谱
+ResponseSpectrum *GetPseudoResponseSpectrumAtPeriods(const double *acceleration,
+                                                     int size,
+                                                     double frequency,
+                                                     double damping_ratio,
+                                                     const double *period,
+                                                     int period_size)
+{
+    // 异常不能跨过C接口，参数无效或计算失败时返回nullptr
+    if (acceleration == nullptr || size <= 0 || period == nullptr
+        || period_size <= 0)
+    {
+        return nullptr;
+    }
+    try
+    {
+        // 创建计算对象
+        std::vector<double> acc(acceleration, acceleration + size);
+        gmp_calculation::GmpCalculation gmp(acc, frequency, damping_ratio);
+        gmp.set_response_spectrum_periods(
+            std::vector<double>(period, period + period_size));
+        auto response = gmp.get_pseudo_response_spectrum();
+
+        // 创建输出对象
+        return CopyResponseSpectrum(response, 0.0);
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
 
-    return result;
+// 生成对数分布的周期
+double *GetLogarithmicPeriods(double min_period,
+                              double max_period,
+                              int period_size)
+{
+    // 异常不能跨过C接口，参数无效时返回nullptr
+    if (period_size <= 0)
+    {
+        return nullptr;
+    }
+    try
+    {
+        auto periods = gmp_calculation::LogarithmicPeriods(
+            min_period, max_period, period_size);
+
+        // 创建输出对象
+        double *result = new double[periods.size()];
+        std::copy(periods.begin(), periods.end(), result);
+
+        return result;
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+}
+
+// 从文件读入FFTW wisdom
+int LoadFftWisdom(const char *wisdom_file, int measure)
+{
+    auto &cache = numerical_algorithm::FftPlanCache::Global();
+    if (measure != 0)
+    {
+        cache.set_planner_flags(FFTW_MEASURE);
+    }
+    return cache.LoadWisdom(wisdom_file) ? 1 : 0;
+}
+
+// 把当前的FFTW wisdom保存到文件
+int SaveFftWisdom(const char *wisdom_file)
+{
+    return numerical_algorithm::FftPlanCache::Global().SaveWisdom(wisdom_file)
+               ? 1
+               : 0;
 }
 
 // 释放反应谱结果内存
@@ -90,6 +219,7 @@ void FreeResponseSpectrum(ResponseSpectrum *memory)
         delete[] memory->Sa;
         delete[] memory->Sv;
         delete[] memory->Sd;
+        delete[] memory->period;
         delete memory;
     }
 }
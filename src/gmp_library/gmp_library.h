@@ -34,13 +34,12 @@ extern "C"
         double *Sv;
         double *Sd;
 
-        // 以下两个参数是希望能从设置中读取，作为参数提供给计算反应谱的函数
-        // 不过目前还没有设置这个功能，故暂时在程序内使用了比较通用的值
-
         // 计算结果长度
         int result_size;
-        // 反应谱横轴间隔
+        // 反应谱横轴间隔，周期不是等间隔分布时为0
         double dt;
+        // 各谱值对应的周期
+        double *period;
     } ResponseSpectrum;
 
     // 计算反应谱
@@ -67,6 +66,61 @@ extern "C"
                               double frequency,
                               double damping_ratio);
 
+    // 计算指定周期的反应谱
+    // @param acceleration: 加速度数据
+    // @param size: 加速度数据长度
+    // @param frequency: 采样频率
+    // @param damping_ratio: 阻尼比
+    // @param period: 周期，须为正的有限值
+    // @param period_size: 周期数
+    // @return ResponseSpectrum: 反应谱计算结果；指针为空、长度不为正、周期
+    //         无效或计算失败时返回nullptr
+    __declspec(dllexport) ResponseSpectrum *
+    GetResponseSpectrumAtPeriods(const double *acceleration,
+                                 int size,
+                                 double frequency,
+                                 double damping_ratio,
+                                 const double *period,
+                                 int period_size);
+
+    // 计算指定周期的拟反应谱
+    // @param acceleration: 加速度数据
+    // @param size: 加速度数据长度
+    // @param frequency: 采样频率
+    // @param damping_ratio: 阻尼比
+    // @param period: 周期，须为正的有限值
+    // @param period_size: 周期数
+    // @return ResponseSpectrum: 反应谱计算结果；指针为空、长度不为正、周期
+    //         无效或计算失败时返回nullptr
+    __declspec(dllexport) ResponseSpectrum *
+    GetPseudoResponseSpectrumAtPeriods(const double *acceleration,
+                                       int size,
+                                       double frequency,
+                                       double damping_ratio,
+                                       const double *period,
+                                       int period_size);
+
+    // 生成对数分布的周期，首尾分别为最小周期和最大周期
+    // @param min_period: 最小周期
+    // @param max_period: 最大周期
+    // @param period_size: 周期数
+    // @return double*: 周期，由FreeArray释放；参数无效时返回nullptr
+    __declspec(dllexport) double *GetLogarithmicPeriods(double min_period,
+                                                        double max_period,
+                                                        int period_size);
+
+    // 从文件读入FFTW wisdom，之后相同长度的Fourier变换直接使用其中的计划
+    // @param wisdom_file: wisdom文件路径
+    // @param measure: 非0时以FFTW_MEASURE规划之后创建的计划
+    // @return int: 读入成功时返回1，否则返回0
+    __declspec(dllexport) int LoadFftWisdom(const char *wisdom_file,
+                                            int measure);
+
+    // 把当前的FFTW wisdom保存到文件
+    // @param wisdom_file: wisdom文件路径
+    // @return int: 保存成功时返回1，否则返回0
+    __declspec(dllexport) int SaveFftWisdom(const char *wisdom_file);
+
     // 释放反应谱结果内存
     // @param memory: 反应谱结果
     __declspec(dllexport) void FreeResponseSpectrum(ResponseSpectrum *memory);
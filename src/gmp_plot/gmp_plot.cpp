@@ -39,14 +39,7 @@ void PlotResponseSpectrum(const double *acceleration,
     std::vector<double> acc(acceleration, acceleration + size);
     gmp_calculation::GmpCalculation gmp(acc, frequency, damping_ratio);
     auto response = gmp.ResponseSpectrum();
-
-    // 创建周期序列
-    double dt = 0.01;
-    std::vector<double> period;
-    for (size_t i = 0; i < response.Sa.size(); i++)
-    {
-        period.push_back(i * dt);
-    }
+    const auto &period = response.periods;
 
     // 绘制反应谱图
     data_visualization::PlotXY plot1(period,
@@ -87,14 +80,7 @@ void PlotPseudoResponseSpectrum(const double *acceleration,
     std::vector<double> acc(acceleration, acceleration + size);
     gmp_calculation::GmpCalculation gmp(acc, frequency, damping_ratio);
     auto response = gmp.PseudoResponseSpectrum();
-
-    // 创建周期序列
-    double dt = 0.01;
-    std::vector<double> period;
-    for (size_t i = 1; i <= response.Sa.size(); i++)
-    {
-        period.push_back(i * dt);
-    }
+    const auto &period = response.periods;
 
     // 绘制拟反应谱图
     data_visualization::PlotXY plot1(period,
@@ -35,6 +35,15 @@ enum class FilterFunction
     filtfilt
 };
 
+// 滤波器结构
+enum class FilterStructure
+{
+    // 传递函数多项式（直接型）
+    transfer_function,
+    // 二阶节级联（直接II型转置），低截止频率和高阶时数值稳定
+    second_order_sections
+};
+
 // 滤波算法基类
 class BasicFiltering
 {
@@ -64,8 +64,11 @@ ButterworthFilterDesign::ButterworthFilterDesign(int filter_order,
     DesignFilter();
 }
 
-// 计算滤波器参数的函数
-void ButterworthFilterDesign::ComputeDenCoeffs()
+// 计算各极点对应的复三项式系数，第k项为 1 + t_k z^-1 + r_k z^-2
+// tCoeffs、rCoeffs中第2k、2k+1个元素分别为t_k、r_k的实部和虚部
+void ButterworthFilterDesign::ComputeTrinomialCoeffs(
+    std::vector<double> &tCoeffs,
+    std::vector<double> &rCoeffs) const
 {
     double cp =
         cos(M_PI * (high_frequency_ + low_frequency_) / 2.0); // cosine of phi
@@ -75,8 +78,8 @@ void ButterworthFilterDesign::ComputeDenCoeffs()
     double ct = cos(theta); // cosine of theta
     double s2t = 2.0 * st * ct;                     // sine of 2*theta
     double c2t = 2.0 * ct * ct - 1.0;               // cosine of 2*theta
-    std::vector<double> rCoeffs(2 * filter_order_); // z^-2 coefficients
-    std::vector<double> tCoeffs(2 * filter_order_); // z^-1 coefficients
+    rCoeffs.resize(2 * filter_order_);              // z^-2 coefficients
+    tCoeffs.resize(2 * filter_order_);              // z^-1 coefficients
     double poleAngle;                               // pole angle
     double sinPoleAngle;                            // sine of pole angle
     double cosPoleAngle;                            // cosine of pole angle
@@ -93,6 +96,14 @@ void ButterworthFilterDesign::ComputeDenCoeffs()
         tCoeffs[2 * k] = -2.0 * cp * (ct + st * sinPoleAngle) / a;
         tCoeffs[2 * k + 1] = -2.0 * cp * st * cosPoleAngle / a;
     }
+}
+
+// 计算滤波器分母系数
+void ButterworthFilterDesign::ComputeDenCoeffs()
+{
+    std::vector<double> rCoeffs; // z^-2 coefficients
+    std::vector<double> tCoeffs; // z^-1 coefficients
+    ComputeTrinomialCoeffs(tCoeffs, rCoeffs);
 
     coefficients_a_ = TrinomialMultiply(tCoeffs, rCoeffs);
 
@@ -124,14 +135,8 @@ void ButterworthFilterDesign::ComputeNumCoeffs()
     }
     coefficients_b_[2 * filter_order_] = tCoeffs[filter_order_];
 
-    double cp[2] = {};
-    double wn;
-    cp[0] = 2 * 2.0 * tan(M_PI * low_frequency_ / 2.0);
-    cp[1] = 2 * 2.0 * tan(M_PI * high_frequency_ / 2.0);
-
     // center frequency
-    wn = sqrt(cp[0] * cp[1]);
-    wn = 2 * atan2(wn, 4);
+    double wn = CenterFrequency();
     const std::complex<double> result = std::complex<double>(-1, 0);
 
     for (int k = 0; k < filter_order_ * 2 + 1; k++)
@@ -154,6 +159,67 @@ void ButterworthFilterDesign::ComputeNumCoeffs()
         coefficients_b_.pop_back();
 }
 
+// 计算二阶节形式的滤波器参数
+// 每个复三项式的两个极点分别与其共轭极点（来自第n-1-k个三项式）组成一节，
+// 阶数为奇数时中间的三项式为实系数，直接作为一节；各节分子均为1 - z^-2
+void ButterworthFilterDesign::ComputeSosCoeffs()
+{
+    std::vector<double> rCoeffs; // z^-2 coefficients
+    std::vector<double> tCoeffs; // z^-1 coefficients
+    ComputeTrinomialCoeffs(tCoeffs, rCoeffs);
+
+    sos_coefficients_.clear();
+    auto add_section = [this](double a1, double a2) {
+        sos_coefficients_.push_back({1.0, 0.0, -1.0, 1.0, a1, a2});
+    };
+    for (int k = 0; k < filter_order_ / 2; ++k)
+    {
+        // z^2 + t z + r = 0 的两个根
+        std::complex<double> t(tCoeffs[2 * k], tCoeffs[2 * k + 1]);
+        std::complex<double> r(rCoeffs[2 * k], rCoeffs[2 * k + 1]);
+        std::complex<double> d = std::sqrt(t * t - 4.0 * r);
+        for (const auto &pole : {(-t + d) / 2.0, (-t - d) / 2.0})
+        {
+            add_section(-2.0 * pole.real(), std::norm(pole));
+        }
+    }
+    if (filter_order_ % 2)
+    {
+        int k = filter_order_ / 2;
+        add_section(tCoeffs[2 * k], rCoeffs[2 * k]);
+    }
+
+    // 各节在中心频率处归一化为单位增益，不依赖传递函数多项式，
+    // 高阶时同样准确；总响应在中心频率处为负时翻转第一节的符号
+    auto z = std::polar(1.0, -CenterFrequency());
+    std::complex<double> response = 1.0;
+    for (auto &section : sos_coefficients_)
+    {
+        auto den = 1.0 + section[4] * z + section[5] * z * z;
+        auto num = 1.0 - z * z;
+        double section_gain = std::abs(den) / std::abs(num);
+        section[0] *= section_gain;
+        section[2] *= section_gain;
+        response *= section_gain * num / den;
+    }
+    if (!sos_coefficients_.empty() && response.real() < 0)
+    {
+        sos_coefficients_.front()[0] = -sos_coefficients_.front()[0];
+        sos_coefficients_.front()[2] = -sos_coefficients_.front()[2];
+    }
+}
+
+// 计算带通滤波器的中心频率（数字角频率）
+double ButterworthFilterDesign::CenterFrequency() const
+{
+    double cp[2] = {};
+    double wn;
+    cp[0] = 2 * 2.0 * tan(M_PI * low_frequency_ / 2.0);
+    cp[1] = 2 * 2.0 * tan(M_PI * high_frequency_ / 2.0);
+    wn = sqrt(cp[0] * cp[1]);
+    return 2 * atan2(wn, 4);
+}
+
 std::vector<double>
 ButterworthFilterDesign::TrinomialMultiply(const std::vector<double> &b,
                                            const std::vector<double> &c) const
@@ -33,6 +33,7 @@
 
 // project headers
 #include "basic_filter_design.h"
+#include "sos_filter.h"
 
 namespace numerical_algorithm
 {
@@ -78,20 +79,34 @@ public:
         coefficients_b = coefficients_b_;
     }
 
+    // 获取二阶节形式的滤波器参数
+    // @param sos_coefficients 二阶节系数，与传递函数形式的滤波器等价
+    void get_sos_coefficients(SosCoefficients &sos_coefficients) const
+    {
+        sos_coefficients = sos_coefficients_;
+    }
+
     // 滤波器设计
     inline void DesignFilter() override
     {
         ComputeDenCoeffs();
         ComputeNumCoeffs();
+        ComputeSosCoeffs();
     }
 
 private:
     // 滤波器参数
     std::vector<double> coefficients_a_{}, coefficients_b_{};
+    // 二阶节形式的滤波器参数
+    SosCoefficients sos_coefficients_{};
 
     // 计算滤波器参数的函数
+    void ComputeTrinomialCoeffs(std::vector<double> &tCoeffs,
+                                std::vector<double> &rCoeffs) const;
     void ComputeDenCoeffs();
     void ComputeNumCoeffs();
+    void ComputeSosCoeffs();
+    double CenterFrequency() const;
     std::vector<double> TrinomialMultiply(const std::vector<double> &b,
                                           const std::vector<double> &c) const;
     std::vector<double> ComputeLP() const;
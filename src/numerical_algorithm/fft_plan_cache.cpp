@@ -0,0 +1,192 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\fft_plan_cache.cpp
+** -----
+** File Created: Sunday, 18th October 2026 00:41:26
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Sunday, 18th October 2026 00:41:26
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：FFTW计划缓存的实现
+
+// associated header
+#include "fft_plan_cache.h"
+
+// stdc++ headers
+#include <complex>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// third-party headers
+#include "fftw3.h"
+
+
+namespace numerical_algorithm
+{
+
+// FFT计划缓存的键的哈希函数
+std::size_t FftPlanKeyHash::operator()(const FftPlanKey &key) const
+{
+    // 长度左移两位，低两位为方向和对齐
+    return std::hash<std::size_t>()(
+        (key.fft_size_ << 2)
+        | (static_cast<std::size_t>(key.direction_) << 1)
+        | static_cast<std::size_t>(key.aligned_));
+}
+
+// 析构函数，销毁所有计划
+FftPlanCache::~FftPlanCache() { Clear(); }
+
+// 全局共享的计划缓存
+FftPlanCache &FftPlanCache::Global()
+{
+    static FftPlanCache cache;
+    return cache;
+}
+
+// 获取计划，未缓存时创建并缓存
+fftw_plan
+FftPlanCache::Get(std::size_t fft_size, FftDirection direction, bool aligned)
+{
+    FftPlanKey key{fft_size, direction, aligned};
+
+    // FFTW的规划器不是线程安全的，计划在锁内创建
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = plans_.find(key);
+    if (it != plans_.end())
+    {
+        ++hit_;
+        return it->second;
+    }
+    ++miss_;
+    auto plan = CreatePlan(key);
+    plans_.emplace(key, plan);
+    return plan;
+}
+
+// 正向实数FFT
+void FftPlanCache::Forward(std::size_t fft_size,
+                           const double *input,
+                           std::complex<double> *output)
+{
+    bool aligned = IsFftAligned(input) && IsFftAligned(output);
+    // 计划以FFTW_PRESERVE_INPUT创建，不会修改输入
+    fftw_execute_dft_r2c(Get(fft_size, FftDirection::forward, aligned),
+                         const_cast<double *>(input),
+                         reinterpret_cast<fftw_complex *>(output));
+}
+
+// 逆向实数FFT
+void FftPlanCache::Backward(std::size_t fft_size,
+                            std::complex<double> *input,
+                            double *output)
+{
+    bool aligned = IsFftAligned(input) && IsFftAligned(output);
+    fftw_execute_dft_c2r(Get(fft_size, FftDirection::backward, aligned),
+                         reinterpret_cast<fftw_complex *>(input),
+                         output);
+}
+
+// 从文件读入wisdom
+bool FftPlanCache::LoadWisdom(const std::string &wisdom_file)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return fftw_import_wisdom_from_filename(wisdom_file.c_str()) != 0;
+}
+
+// 把当前的wisdom保存到文件
+bool FftPlanCache::SaveWisdom(const std::string &wisdom_file) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return fftw_export_wisdom_to_filename(wisdom_file.c_str()) != 0;
+}
+
+// 销毁所有计划并清空统计
+void FftPlanCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto &entry : plans_)
+    {
+        fftw_destroy_plan(entry.second);
+    }
+    plans_.clear();
+    hit_ = 0;
+    miss_ = 0;
+}
+
+// 设置规划方式
+void FftPlanCache::set_planner_flags(unsigned planner_flags)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    planner_flags_ = planner_flags;
+}
+
+// 获取规划方式
+unsigned FftPlanCache::get_planner_flags() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return planner_flags_;
+}
+
+// 获取已缓存的计划数量
+std::size_t FftPlanCache::get_size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return plans_.size();
+}
+
+// 获取命中和未命中次数
+std::pair<std::size_t, std::size_t> FftPlanCache::get_statistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {hit_, miss_};
+}
+
+// 创建计划
+fftw_plan FftPlanCache::CreatePlan(const FftPlanKey &key) const
+{
+    if (key.fft_size_ == 0)
+        throw std::invalid_argument("The FFT size must be positive.");
+
+    // 1.在对齐的临时数组上规划，FFTW_MEASURE规划时会覆盖数组内容
+    std::unique_ptr<double, decltype(&fftw_free)> signal(
+        fftw_alloc_real(key.fft_size_), &fftw_free);
+    std::unique_ptr<fftw_complex, decltype(&fftw_free)> spectrum(
+        fftw_alloc_complex(key.fft_size_ / 2 + 1), &fftw_free);
+    if (!signal || !spectrum)
+        throw std::bad_alloc();
+
+    // 2.执行时数组不对齐的计划须以FFTW_UNALIGNED创建
+    unsigned flags = planner_flags_;
+    if (!key.aligned_)
+    {
+        flags |= FFTW_UNALIGNED;
+    }
+    auto size = static_cast<int>(key.fft_size_);
+    fftw_plan plan =
+        key.direction_ == FftDirection::forward
+            ? fftw_plan_dft_r2c_1d(size,
+                                   signal.get(),
+                                   spectrum.get(),
+                                   flags | FFTW_PRESERVE_INPUT)
+            : fftw_plan_dft_c2r_1d(size, spectrum.get(), signal.get(), flags);
+    if (plan == nullptr)
+        throw std::runtime_error("Failed to create the FFTW plan.");
+    return plan;
+}
+
+} // namespace numerical_algorithm
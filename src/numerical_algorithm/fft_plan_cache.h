@@ -0,0 +1,175 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\fft_plan_cache.h
+** -----
+** File Created: Sunday, 18th October 2026 00:41:26
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Sunday, 18th October 2026 00:41:26
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：FFTW计划缓存
+// 以（FFT长度、方向、数组是否对齐）为键缓存一维实数FFT计划，计划在缓存中保留到
+// 进程结束，执行时传入实际的数组。FFTW的规划器不是线程安全的，本项目中的计划
+// 创建、销毁和wisdom读写都应通过该缓存在锁内进行；计划的执行是线程安全的。
+// 默认以FFTW_ESTIMATE规划；改为FFTW_MEASURE时首次规划较慢，可在启动时读入上次
+// 保存的wisdom，相同长度的计划即可直接得到，不再有规划开销。
+// Forward/Backward每次调用都在锁内查找计划，适合单次变换；重复变换或多线程
+// 变换时应保存Get返回的计划，以fftw_execute_dft_r2c/c2r直接执行。
+
+#ifndef NUMERICAL_ALGORITHM_FFT_PLAN_CACHE_H_
+#define NUMERICAL_ALGORITHM_FFT_PLAN_CACHE_H_
+
+// stdc++ headers
+#include <complex>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+// third-party headers
+#include "fftw3.h"
+
+
+namespace numerical_algorithm
+{
+
+// 一维实数FFT的方向
+enum class FftDirection
+{
+    // 实数到复数的正向变换
+    forward,
+    // 复数到实数的逆向变换（未归一化）
+    backward
+};
+
+// FFT计划缓存的键
+struct FftPlanKey
+{
+    // FFT长度
+    std::size_t fft_size_{};
+    // 变换方向
+    FftDirection direction_{FftDirection::forward};
+    // 输入输出数组是否都满足FFTW的SIMD对齐要求
+    bool aligned_{};
+
+    bool operator==(const FftPlanKey &other) const
+    {
+        return fft_size_ == other.fft_size_
+               && direction_ == other.direction_
+               && aligned_ == other.aligned_;
+    }
+};
+
+// FFT计划缓存的键的哈希函数
+struct FftPlanKeyHash
+{
+    std::size_t operator()(const FftPlanKey &key) const;
+};
+
+// FFTW计划缓存类，线程安全
+class FftPlanCache
+{
+public:
+    // 默认构造函数
+    FftPlanCache() = default;
+
+    // FFTW计划不可复制
+    FftPlanCache(const FftPlanCache &) = delete;
+    FftPlanCache &operator=(const FftPlanCache &) = delete;
+
+    // 析构函数，销毁所有计划
+    ~FftPlanCache();
+
+    // 全局共享的计划缓存
+    // @return 全局计划缓存的引用
+    static FftPlanCache &Global();
+
+    // 获取计划，未缓存时创建并缓存
+    // @param fft_size FFT长度
+    // @param direction 变换方向
+    // @param aligned 执行时的数组是否都满足SIMD对齐要求
+    // @return FFTW计划，须以fftw_execute_dft_r2c/c2r传入数组执行（不可原位）
+    fftw_plan Get(std::size_t fft_size, FftDirection direction, bool aligned);
+
+    // 正向实数FFT，按数组是否对齐选择计划
+    // @param fft_size FFT长度
+    // @param input 长度为fft_size的实数输入，不会被修改
+    // @param output 长度为fft_size / 2 + 1的复数输出，不能与输入重叠
+    void Forward(std::size_t fft_size,
+                 const double *input,
+                 std::complex<double> *output);
+
+    // 逆向实数FFT（未归一化），按数组是否对齐选择计划
+    // @param fft_size FFT长度
+    // @param input 长度为fft_size / 2 + 1的复数输入，会被覆盖
+    // @param output 长度为fft_size的实数输出，不能与输入重叠
+    void Backward(std::size_t fft_size,
+                  std::complex<double> *input,
+                  double *output);
+
+    // 从文件读入wisdom，之后创建的计划可直接使用其中的规划结果
+    // @param wisdom_file wisdom文件路径
+    // @return 读入成功时返回true
+    bool LoadWisdom(const std::string &wisdom_file);
+
+    // 把当前的wisdom（包括已创建计划的规划结果）保存到文件
+    // @param wisdom_file wisdom文件路径
+    // @return 保存成功时返回true
+    bool SaveWisdom(const std::string &wisdom_file) const;
+
+    // 销毁所有计划并清空统计，调用时其他线程不能持有或执行已获取的计划
+    void Clear();
+
+    // 设置规划方式，只影响之后创建的计划
+    // @param planner_flags FFTW_ESTIMATE、FFTW_MEASURE或FFTW_PATIENT等
+    void set_planner_flags(unsigned planner_flags);
+
+    // 获取规划方式
+    // @return 规划方式
+    unsigned get_planner_flags() const;
+
+    // 获取已缓存的计划数量
+    // @return 已缓存的计划数量
+    std::size_t get_size() const;
+
+    // 获取命中和未命中次数
+    // @return （命中次数，未命中次数）
+    std::pair<std::size_t, std::size_t> get_statistics() const;
+
+private:
+    // 保护以下成员和FFTW规划器的互斥量
+    mutable std::mutex mutex_{};
+    // 规划方式
+    unsigned planner_flags_{FFTW_ESTIMATE};
+    // 已创建的计划
+    std::unordered_map<FftPlanKey, fftw_plan, FftPlanKeyHash> plans_{};
+    // 命中和未命中次数
+    std::size_t hit_{}, miss_{};
+
+    // 创建计划，调用时需持有锁
+    fftw_plan CreatePlan(const FftPlanKey &key) const;
+};
+
+// 数组是否满足FFTW的SIMD对齐要求
+// @param data 数组
+// @return 满足对齐要求时返回true
+inline bool IsFftAligned(const void *data)
+{
+    return fftw_alignment_of(
+               const_cast<double *>(static_cast<const double *>(data)))
+           == 0;
+}
+
+} // namespace numerical_algorithm
+
+#endif // NUMERICAL_ALGORITHM_FFT_PLAN_CACHE_H_
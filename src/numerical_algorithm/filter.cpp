@@ -22,9 +22,15 @@
 #include "filter.h"
 
 // stdc++ headers
+#include <algorithm>
 #include <stdexcept>
 #include <vector>
 
+// project headers
+#include "multichannel_filter.h"
+#include "scratch_arena.h"
+#include "sos_filter.h"
+
 
 namespace numerical_algorithm
 {
@@ -36,6 +42,22 @@ Filter::Filtering(const std::vector<std::vector<double>> &input_signal)
     auto output_signal = std::vector<std::vector<double>>(
         input_signal.size(),
         std::vector<double>(input_signal.front().size(), 0.0));
+    if (structure_ == FilterStructure::second_order_sections)
+    {
+        // 各通道交错存储后同步滤波，交错信号和状态为临时向量
+        auto signal = MakeScratchVector();
+        Interleave(input_signal, signal);
+        auto state = MakeScratchVector(
+            2 * sos_coefficients_.size() * input_signal.size());
+        MultichannelSosFilter(sos_coefficients_,
+                              signal.data(),
+                              signal.data(),
+                              input_signal.front().size(),
+                              input_signal.size(),
+                              state.data());
+        Deinterleave(signal, input_signal.size(), output_signal);
+        return output_signal;
+    }
     if (coefficients_a_.empty() || coefficients_b_.empty())
     {
         throw std::runtime_error("Filter coefficients are empty.");
@@ -64,6 +86,11 @@ Filter::Filtering(const std::vector<std::vector<double>> &input_signal)
 std::vector<double> Filter::Filtering(const std::vector<double> &input_signal)
 {
     auto output_signal = std::vector<double>(input_signal.size(), 0.0);
+    if (structure_ == FilterStructure::second_order_sections)
+    {
+        SosFilter(sos_coefficients_, input_signal, output_signal);
+        return output_signal;
+    }
     if (coefficients_a_.empty() || coefficients_b_.empty())
     {
         throw std::runtime_error("Filter coefficients are empty.");
@@ -129,35 +156,32 @@ void Filter::fir_filter(const std::vector<double> &input_signal,
     }
 }
 
-// IIR滤波算法
+// IIR滤波算法，各通道交错存储后同步滤波（直接II型转置结构）
 void Filter::iir_filter(const std::vector<std::vector<double>> &input_signal,
                         std::vector<std::vector<double>> &output_signal)
 {
-    output_signal = std::vector<std::vector<double>>(
-        input_signal.size(),
-        std::vector<double>(input_signal.front().size(), 0.0));
-    for (std::size_t i = 0; i < input_signal.size(); ++i)
-    {
-        for (std::size_t j = 0; j < input_signal.front().size(); ++j)
-        {
-            for (std::size_t k = 0; k < coefficients_b_.size(); ++k)
-            {
-                if (j >= k)
-                {
-                    output_signal[i][j] +=
-                        coefficients_b_[k] * input_signal[i][j - k];
-                }
-            }
-            for (std::size_t k = 1; k < coefficients_a_.size(); ++k)
-            {
-                if (j >= k)
-                {
-                    output_signal[i][j] -=
-                        coefficients_a_[k] * output_signal[i][j - k];
-                }
-            }
-        }
-    }
+    // 系数按a[0]归一化并补齐到相同长度
+    auto order = std::max(coefficients_a_.size(), coefficients_b_.size());
+    std::vector<double> a(coefficients_a_), b(coefficients_b_);
+    a.resize(order, 0.0);
+    b.resize(order, 0.0);
+    double a0 = a.front();
+    std::transform(
+        a.begin(), a.end(), a.begin(), [a0](double v) { return v / a0; });
+    std::transform(
+        b.begin(), b.end(), b.begin(), [a0](double v) { return v / a0; });
+
+    auto signal = MakeScratchVector();
+    Interleave(input_signal, signal);
+    auto state = MakeScratchVector((order - 1) * input_signal.size());
+    MultichannelFilter(a,
+                       b,
+                       signal.data(),
+                       signal.data(),
+                       input_signal.front().size(),
+                       input_signal.size(),
+                       state.data());
+    Deinterleave(signal, input_signal.size(), output_signal);
 }
 
 // IIR滤波算法
@@ -27,6 +27,7 @@
 // project headers
 #include "basic_filtering.h"
 #include "butterworth_filter_design.h"
+#include "sos_filter.h"
 
 
 namespace numerical_algorithm
@@ -53,11 +54,25 @@ public:
         : coefficients_a_(1, 1.0), coefficients_b_(coefficients_b)
     {}
 
+    // 由二阶节系数构造
+    // @param sos_coefficients 二阶节系数
+    explicit Filter(SosCoefficients sos_coefficients)
+        : structure_(FilterStructure::second_order_sections),
+          sos_coefficients_(sos_coefficients)
+    {
+        NormalizeSos(sos_coefficients_);
+    }
+
     // 由butterworth滤波器设计构造
     // @param filter_design butterworth滤波器设计类
-    explicit Filter(const ButterworthFilterDesign &filter_design)
+    // @param structure 滤波器结构
+    explicit Filter(
+        const ButterworthFilterDesign &filter_design,
+        FilterStructure structure = FilterStructure::transfer_function)
+        : structure_(structure)
     {
         filter_design.get_filter_coefficients(coefficients_a_, coefficients_b_);
+        filter_design.get_sos_coefficients(sos_coefficients_);
     }
 
     // 析构函数
@@ -76,8 +91,12 @@ public:
     Filtering(const std::vector<double> &input_signal) override;
 
 private:
+    // 滤波器结构
+    FilterStructure structure_{FilterStructure::transfer_function};
     // filter滤波方法参数
     std::vector<double> coefficients_a_, coefficients_b_;
+    // 二阶节形式的滤波方法参数
+    SosCoefficients sos_coefficients_{};
 
     // 有限脉冲响应滤波器（矩阵）
     void fir_filter(const std::vector<std::vector<double>> &input_signal,
@@ -0,0 +1,167 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\filter_design_cache.cpp
+** -----
+** File Created: Friday, 16th October 2026 16:20:37
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 16:20:37
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：Butterworth滤波器设计缓存的实现
+
+// associated header
+#include "filter_design_cache.h"
+
+// stdc++ headers
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+
+namespace numerical_algorithm
+{
+
+// 滤波器设计缓存的键的哈希函数
+std::size_t FilterDesignKeyHash::operator()(const FilterDesignKey &key) const
+{
+    // 按boost::hash_combine的方式组合各字段的哈希值
+    std::size_t seed = std::hash<int>()(key.filter_order_);
+    auto combine = [&seed](std::size_t value) {
+        seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    };
+    combine(std::hash<double>()(key.low_frequency_));
+    combine(std::hash<double>()(key.high_frequency_));
+    combine(std::hash<int>()(static_cast<int>(key.filter_type_)));
+    return seed;
+}
+
+// 由容量构造
+FilterDesignCache::FilterDesignCache(std::size_t capacity)
+    : capacity_(capacity)
+{}
+
+// 全局共享的设计缓存
+FilterDesignCache &FilterDesignCache::Global()
+{
+    static FilterDesignCache cache;
+    return cache;
+}
+
+// 获取滤波器设计，未缓存时设计并缓存
+std::shared_ptr<const ButterworthFilterDesign>
+FilterDesignCache::Get(int filter_order,
+                       double low_frequency,
+                       double high_frequency,
+                       FilterType filter_type)
+{
+    FilterDesignKey key{
+        filter_order, low_frequency, high_frequency, filter_type};
+
+    // 1.已缓存时移到表头并返回
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it != index_.end())
+        {
+            ++hit_;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return it->second->second;
+        }
+        ++miss_;
+    }
+
+    // 2.在锁外设计，其他线程可同时查询
+    auto design = std::make_shared<const ButterworthFilterDesign>(
+        filter_order, low_frequency, high_frequency, filter_type);
+
+    // 3.加入缓存，其他线程已加入相同的设计时使用已有的设计
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end())
+    {
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->second;
+    }
+    if (capacity_ == 0)
+    {
+        return design;
+    }
+    entries_.emplace_front(key, design);
+    index_.emplace(key, entries_.begin());
+    Evict();
+    return design;
+}
+
+// 预先设计并缓存一组滤波器
+void FilterDesignCache::Prewarm(
+    int filter_order,
+    const std::vector<std::pair<double, double>> &bands,
+    FilterType filter_type)
+{
+    for (const auto &band : bands)
+    {
+        Get(filter_order, band.first, band.second, filter_type);
+    }
+}
+
+// 清空缓存和统计
+void FilterDesignCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    hit_ = 0;
+    miss_ = 0;
+}
+
+// 设置容量
+void FilterDesignCache::set_capacity(std::size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    capacity_ = capacity;
+    Evict();
+}
+
+// 获取容量
+std::size_t FilterDesignCache::get_capacity() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+}
+
+// 获取已缓存的设计数量
+std::size_t FilterDesignCache::get_size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+// 获取命中和未命中次数
+std::pair<std::size_t, std::size_t> FilterDesignCache::get_statistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {hit_, miss_};
+}
+
+// 淘汰超出容量的设计
+void FilterDesignCache::Evict()
+{
+    while (entries_.size() > capacity_)
+    {
+        index_.erase(entries_.back().first);
+        entries_.pop_back();
+    }
+}
+
+} // namespace numerical_algorithm
@@ -0,0 +1,146 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\filter_design_cache.h
+** -----
+** File Created: Friday, 16th October 2026 16:20:37
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 16:20:37
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：Butterworth滤波器设计缓存
+// 以（阶数、截止频率、类型）为键缓存设计结果，容量有限，超出时淘汰最久未使用
+// 的设计；返回的设计不可修改，可在多个线程之间共享
+
+#ifndef NUMERICAL_ALGORITHM_FILTER_DESIGN_CACHE_H_
+#define NUMERICAL_ALGORITHM_FILTER_DESIGN_CACHE_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// project headers
+#include "basic_filter_design.h"
+#include "butterworth_filter_design.h"
+
+
+namespace numerical_algorithm
+{
+
+// 滤波器设计缓存的键
+struct FilterDesignKey
+{
+    // 滤波器阶数
+    int filter_order_{};
+    // 滤波器截止频率
+    double low_frequency_{}, high_frequency_{};
+    // 滤波器类型
+    FilterType filter_type_{FilterType::bandpass};
+
+    bool operator==(const FilterDesignKey &other) const
+    {
+        return filter_order_ == other.filter_order_
+               && low_frequency_ == other.low_frequency_
+               && high_frequency_ == other.high_frequency_
+               && filter_type_ == other.filter_type_;
+    }
+};
+
+// 滤波器设计缓存的键的哈希函数
+struct FilterDesignKeyHash
+{
+    std::size_t operator()(const FilterDesignKey &key) const;
+};
+
+// Butterworth滤波器设计缓存类，线程安全
+class FilterDesignCache
+{
+public:
+    // 由容量构造
+    // @param capacity 最多缓存的设计数量
+    explicit FilterDesignCache(std::size_t capacity = 1024);
+
+    // 析构函数
+    ~FilterDesignCache() = default;
+
+    // 全局共享的设计缓存
+    // @return 全局设计缓存的引用
+    static FilterDesignCache &Global();
+
+    // 获取滤波器设计，未缓存时设计并缓存
+    // @param filter_order 滤波器阶数
+    // @param low_frequency 低频截止频率
+    // @param high_frequency 高频截止频率
+    // @param filter_type 滤波器类型（默认带通）
+    // @return 共享的滤波器设计
+    std::shared_ptr<const ButterworthFilterDesign>
+    Get(int filter_order,
+        double low_frequency,
+        double high_frequency,
+        FilterType filter_type = FilterType::bandpass);
+
+    // 预先设计并缓存一组滤波器
+    // @param filter_order 滤波器阶数
+    // @param bands 各滤波器的（低频截止频率，高频截止频率）
+    // @param filter_type 滤波器类型（默认带通）
+    void Prewarm(int filter_order,
+                 const std::vector<std::pair<double, double>> &bands,
+                 FilterType filter_type = FilterType::bandpass);
+
+    // 清空缓存和统计
+    void Clear();
+
+    // 设置容量，超出部分立即淘汰
+    // @param capacity 最多缓存的设计数量
+    void set_capacity(std::size_t capacity);
+
+    // 获取容量
+    // @return 最多缓存的设计数量
+    std::size_t get_capacity() const;
+
+    // 获取已缓存的设计数量
+    // @return 已缓存的设计数量
+    std::size_t get_size() const;
+
+    // 获取命中和未命中次数
+    // @return （命中次数，未命中次数）
+    std::pair<std::size_t, std::size_t> get_statistics() const;
+
+private:
+    using Entry = std::pair<FilterDesignKey,
+                            std::shared_ptr<const ButterworthFilterDesign>>;
+
+    // 保护以下成员的互斥量
+    mutable std::mutex mutex_{};
+    // 容量
+    std::size_t capacity_{};
+    // 按最近使用顺序排列的设计，表头为最近使用
+    std::list<Entry> entries_{};
+    // 键到链表位置的索引
+    std::unordered_map<FilterDesignKey,
+                       std::list<Entry>::iterator,
+                       FilterDesignKeyHash>
+        index_{};
+    // 命中和未命中次数
+    std::size_t hit_{}, miss_{};
+
+    // 淘汰超出容量的设计，调用时需持有锁
+    void Evict();
+};
+
+} // namespace numerical_algorithm
+
+#endif // NUMERICAL_ALGORITHM_FILTER_DESIGN_CACHE_H_
@@ -31,6 +31,9 @@
 // third-party headers
 #include "eigen3/Eigen/Dense"
 
+// project headers
+#include "multichannel_filter.h"
+
 
 namespace numerical_algorithm
 {
@@ -39,6 +42,20 @@ namespace numerical_algorithm
 std::vector<std::vector<double>>
 FiltFilt::Filtering(const std::vector<std::vector<double>> &input_signal)
 {
+    // 多个通道且长度相同时同步滤波，否则逐列滤波
+    bool same_size = std::all_of(
+        input_signal.begin(),
+        input_signal.end(),
+        [&input_signal](const std::vector<double> &channel) {
+            return channel.size() == input_signal.front().size();
+        });
+    if (same_size && input_signal.size() > 1)
+    {
+        std::vector<std::vector<double>> output_signal;
+        MultichannelFiltering(input_signal, output_signal);
+        return output_signal;
+    }
+
     auto output_signal = std::vector<std::vector<double>>(
         input_signal.size(),
         std::vector<double>(input_signal.front().size(), 0.0));
@@ -52,21 +69,190 @@ FiltFilt::Filtering(const std::vector<std::vector<double>> &input_signal)
 // 单列滤波算法入口
 std::vector<double> FiltFilt::Filtering(const std::vector<double> &input_signal)
 {
-    int len = static_cast<int>(input_signal.size()); // length of input
-    int nfilt =
-        static_cast<int>(coefficients_b_.size() > coefficients_a_.size())
-            ? coefficients_b_.size()
-            : coefficients_a_.size();
-    int nfact = static_cast<int>(3 * (nfilt - 1)); // length of edge transients
+    std::vector<double> output_signal;
+    Filtering(input_signal, output_signal);
+    return output_signal;
+}
+
+// 单列滤波算法入口，结果写入调用者提供的缓冲区
+void FiltFilt::Filtering(const std::vector<double> &input_signal,
+                         std::vector<double> &output_signal)
+{
+    // 1.确定延拓长度：3倍滤波器阶数（状态变量个数）
+    bool sos = structure_ == FilterStructure::second_order_sections;
+    if (!sos && coefficients_a_.empty())
+        throw std::domain_error("The feedback filter coefficients are empty.");
+    const auto &zi = sos ? sos_zi_ : zi_;
+    int len = static_cast<int>(input_signal.size());
+    int nfact = static_cast<int>(3 * zi.size());
+    if (len <= nfact)
+        throw std::domain_error("Input data too short! Data must have length "
+                                "more than 3 times filter order.");
+
+    // 2.两端奇对称延拓，以消除两端的瞬态
+    signal_.resize(len + 2 * nfact);
+    double _2x0 = 2 * input_signal[0];
+    double _2xl = 2 * input_signal[len - 1];
+    for (int i = 0; i < nfact; ++i)
+    {
+        signal_[i] = _2x0 - input_signal[nfact - i];
+        signal_[nfact + len + i] = _2xl - input_signal[len - 2 - i];
+    }
+    std::copy(
+        input_signal.begin(), input_signal.end(), signal_.begin() + nfact);
+
+    // 3.正向和反向滤波，初始条件为稳态初始条件乘以首个样本
+    state_.resize(zi.size());
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        if (pass == 1)
+        {
+            std::reverse(signal_.begin(), signal_.end());
+        }
+        double y0 = signal_[0];
+        std::transform(zi.begin(),
+                       zi.end(),
+                       state_.begin(),
+                       [y0](double val) { return val * y0; });
+        if (sos)
+        {
+            SosFilter(sos_coefficients_,
+                      signal_.data(),
+                      signal_.data(),
+                      signal_.size(),
+                      state_.data());
+        }
+        else
+        {
+            filter(signal_.data(), signal_.size(), state_.data());
+        }
+    }
 
+    // 4.反向读取，截取原信号区间
+    output_signal.assign(signal_.rbegin() + nfact, signal_.rend() - nfact);
+}
+
+// 多通道同步filtfilt滤波
+// 延拓、初始条件和正反向滤波与单列滤波相同，结果与逐列滤波逐位相同
+void FiltFilt::MultichannelFiltering(
+    const std::vector<std::vector<double>> &input_signal,
+    std::vector<std::vector<double>> &output_signal)
+{
+    // 1.确定延拓长度
+    bool sos = structure_ == FilterStructure::second_order_sections;
+    if (!sos && coefficients_a_.empty())
+        throw std::domain_error("The feedback filter coefficients are empty.");
+    const auto &zi = sos ? sos_zi_ : zi_;
+    std::size_t channel_number = input_signal.size();
+    int len = static_cast<int>(input_signal.front().size());
+    int nfact = static_cast<int>(3 * zi.size());
     if (len <= nfact)
         throw std::domain_error("Input data too short! Data must have length "
                                 "more than 3 times filter order.");
 
-    // set up filter's initial conditions to remove DC offset problems at
-    // the beginning and end of the sequence
+    // 2.两端奇对称延拓，按通道交错存储，逐行（样本）写入
+    std::size_t rows = len + 2 * nfact;
+    signal_.resize(rows * channel_number);
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        double *row = signal_.data() + i * channel_number;
+        int j = static_cast<int>(i) - nfact;
+        for (std::size_t c = 0; c < channel_number; ++c)
+        {
+            const auto &x = input_signal[c];
+            if (j < 0)
+            {
+                row[c] = 2 * x[0] - x[-j];
+            }
+            else if (j < len)
+            {
+                row[c] = x[j];
+            }
+            else
+            {
+                row[c] = 2 * x[len - 1] - x[2 * len - 2 - j];
+            }
+        }
+    }
+
+    // 3.正向和反向滤波，两次滤波之间按行（样本）翻转
+    state_.resize(zi.size() * channel_number);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (std::size_t i = 0; pass == 1 && i < rows / 2; ++i)
+        {
+            std::swap_ranges(signal_.begin() + i * channel_number,
+                             signal_.begin() + (i + 1) * channel_number,
+                             signal_.begin() + (rows - 1 - i) * channel_number);
+        }
+        for (std::size_t k = 0; k < zi.size(); ++k)
+        {
+            for (std::size_t c = 0; c < channel_number; ++c)
+            {
+                state_[k * channel_number + c] = zi[k] * signal_[c];
+            }
+        }
+        if (sos)
+        {
+            MultichannelSosFilter(sos_coefficients_,
+                                  signal_.data(),
+                                  signal_.data(),
+                                  rows,
+                                  channel_number,
+                                  state_.data());
+        }
+        else
+        {
+            MultichannelFilter(coefficients_a_,
+                               coefficients_b_,
+                               signal_.data(),
+                               signal_.data(),
+                               rows,
+                               channel_number,
+                               state_.data());
+        }
+    }
+
+    // 4.反向读取，截取原信号区间
+    output_signal.assign(channel_number, std::vector<double>(len));
+    for (int i = 0; i < len; ++i)
+    {
+        const double *row =
+            signal_.data() + (rows - 1 - nfact - i) * channel_number;
+        for (std::size_t c = 0; c < channel_number; ++c)
+        {
+            output_signal[c][i] = row[c];
+        }
+    }
+}
+
+// 归一化传递函数系数并计算稳态初始条件
+void FiltFilt::PrepareTransferFunction()
+{
+    NormalizeCoefficients();
+    zi_ = SteadyStateCondition();
+}
+
+// 归一化二阶节系数并计算稳态初始条件
+void FiltFilt::PrepareSos()
+{
+    NormalizeSos(sos_coefficients_);
+    SosInitialState(sos_coefficients_, sos_zi_);
+}
+
+// 计算单位阶跃输入下的稳态初始条件，并将系数补齐到相同长度
+std::vector<double> FiltFilt::SteadyStateCondition()
+{
+    int nfilt =
+        static_cast<int>(coefficients_b_.size() > coefficients_a_.size())
+            ? coefficients_b_.size()
+            : coefficients_a_.size();
     coefficients_b_.resize(nfilt, 0);
     coefficients_a_.resize(nfilt, 0);
+    if (nfilt < 2)
+    {
+        return {};
+    }
 
     std::vector<int> rows, cols;
     // rows = [1:nfilt-1           2:nfilt-1             1:nfilt-2];
@@ -106,29 +292,6 @@ std::vector<double> FiltFilt::Filtering(const std::vector<double> &input_signal)
         }
     }
 
-    std::vector<double> leftpad = SubvectorReverse(input_signal, nfact, 1);
-    double _2x0 = 2 * input_signal[0];
-    std::transform(leftpad.begin(),
-                   leftpad.end(),
-                   leftpad.begin(),
-                   [_2x0](double val) { return _2x0 - val; });
-
-    std::vector<double> rightpad =
-        SubvectorReverse(input_signal, len - 2, len - nfact - 1);
-    double _2xl = 2 * input_signal[len - 1];
-    std::transform(rightpad.begin(),
-                   rightpad.end(),
-                   rightpad.begin(),
-                   [_2xl](double val) { return _2xl - val; });
-
-    double y0;
-    std::vector<double> signal1, signal2, zi;
-
-    signal1.reserve(leftpad.size() + input_signal.size() + rightpad.size());
-    AppendVector(signal1, leftpad);
-    AppendVector(signal1, input_signal);
-    AppendVector(signal1, rightpad);
-
     // Calculate initial conditions
     Eigen::MatrixXd sp =
         Eigen::MatrixXd::Zero(MaxVal(rows) + 1, MaxVal(cols) + 1);
@@ -143,29 +306,11 @@ std::vector<double> FiltFilt::Filtering(const std::vector<double> &input_signal)
     Eigen::MatrixXd zzi =
         (sp.inverse()
          * (bb.segment(1, nfilt - 1) - (bb(0) * aa.segment(1, nfilt - 1))));
-    zi.resize(zzi.size());
-
-    // Do the forward and backward filtering
-    y0 = signal1[0];
-    std::transform(zzi.data(),
-                   zzi.data() + zzi.size(),
-                   zi.begin(),
-                   [y0](double val) { return val * y0; });
-    filter(signal1, signal2, zi);
-    std::reverse(signal2.begin(), signal2.end());
-    y0 = signal2[0];
-    std::transform(zzi.data(),
-                   zzi.data() + zzi.size(),
-                   zi.begin(),
-                   [y0](double val) { return val * y0; });
-    filter(signal2, signal1, zi);
-    return SubvectorReverse(signal1, signal1.size() - nfact - 1, nfact);
+    return std::vector<double>(zzi.data(), zzi.data() + zzi.size());
 }
 
-// filtfilt滤波算法的filter函数
-void FiltFilt::filter(const std::vector<double> &input_signal,
-                      std::vector<double> &output_signal,
-                      std::vector<double> zi)
+// 将分母系数归一化为a[0] = 1
+void FiltFilt::NormalizeCoefficients()
 {
     if (coefficients_a_.empty())
         throw std::domain_error("The feedback filter coefficients are empty.");
@@ -191,34 +336,33 @@ void FiltFilt::filter(const std::vector<double> &input_signal,
                        coefficients_b_.begin(),
                        [a0](double v) { return v / a0; });
     }
+}
 
-    size_t input_size = input_signal.size();
-    size_t filter_order =
-        std::max(coefficients_a_.size(), coefficients_b_.size());
-    coefficients_b_.resize(filter_order, 0);
-    coefficients_a_.resize(filter_order, 0);
-    zi.resize(filter_order, 0);
-    output_signal.resize(input_size);
-
-    const double *x = &input_signal[0];
-    const double *b = &coefficients_b_[0];
-    const double *a = &coefficients_a_[0];
-    double *z = &zi[0];
-    double *y = &output_signal[0];
-
-    for (size_t i = 0; i < input_size; ++i)
+// filtfilt滤波算法的filter函数（直接II型转置结构），原位滤波
+void FiltFilt::filter(double *signal, std::size_t size, double *state) const
+{
+    const double *b = coefficients_b_.data();
+    const double *a = coefficients_a_.data();
+    std::size_t n = coefficients_a_.size();
+    if (n == 1)
+    {
+        std::transform(signal,
+                       signal + size,
+                       signal,
+                       [b](double val) { return b[0] * val; });
+        return;
+    }
+    for (std::size_t i = 0; i < size; ++i)
     {
-        size_t order = filter_order - 1;
-        while (order)
+        double x = signal[i];
+        double y = b[0] * x + state[0];
+        for (std::size_t k = 1; k + 1 < n; ++k)
         {
-            if (i >= order)
-                z[order - 1] = b[order] * x[i - order] - a[order] * y[i - order]
-                               + z[order];
-            --order;
+            state[k - 1] = b[k] * x - a[k] * y + state[k];
         }
-        y[i] = b[0] * x[i] + z[0];
+        state[n - 2] = b[n - 1] * x - a[n - 1] * y;
+        signal[i] = y;
     }
-    zi.resize(filter_order - 1);
 }
 
-} // namespace numerical_algorithm
\ No newline at end of file
+} // namespace numerical_algorithm
@@ -23,6 +23,7 @@
 
 // stdc++ headers
 #include <algorithm>
+#include <cstddef>
 #include <vector>
 
 // third-party headers
@@ -30,6 +31,7 @@
 // project headers
 #include "basic_filtering.h"
 #include "butterworth_filter_design.h"
+#include "sos_filter.h"
 
 namespace numerical_algorithm
 {
@@ -47,19 +49,33 @@ public:
     FiltFilt(std::vector<double> coefficients_a,
              std::vector<double> coefficients_b)
         : coefficients_a_(coefficients_a), coefficients_b_(coefficients_b)
-    {}
+    {
+        PrepareTransferFunction();
+    }
 
     // 由一个std::vector作为参数b构造，a默认为1
     // @param coefficients_b 滤波器分子系数
     explicit FiltFilt(std::vector<double> coefficients_b)
         : coefficients_a_(1, 1.0), coefficients_b_(coefficients_b)
-    {}
+    {
+        PrepareTransferFunction();
+    }
+
+    // 由二阶节系数构造
+    // @param sos_coefficients 二阶节系数
+    explicit FiltFilt(SosCoefficients sos_coefficients)
+    {
+        set_sos_coefficients(sos_coefficients);
+    }
 
     // 由ButterworthFilterDesign参数构造
     // @param filter_design butterworth滤波器设计类
-    FiltFilt(const ButterworthFilterDesign &filter_design)
+    // @param structure 滤波器结构
+    FiltFilt(const ButterworthFilterDesign &filter_design,
+             FilterStructure structure = FilterStructure::transfer_function)
+        : structure_(structure)
     {
-        filter_design.get_filter_coefficients(coefficients_a_, coefficients_b_);
+        set_coefficients(filter_design);
     }
 
     // 析构函数
@@ -73,6 +89,8 @@ public:
     {
         coefficients_a_ = coefficients_a;
         coefficients_b_ = coefficients_b;
+        structure_ = FilterStructure::transfer_function;
+        PrepareTransferFunction();
     }
 
     // 设置滤波方法参数
@@ -81,13 +99,34 @@ public:
     {
         coefficients_a_ = std::vector<double>(1, 1.0);
         coefficients_b_ = coefficients_b;
+        structure_ = FilterStructure::transfer_function;
+        PrepareTransferFunction();
     }
 
-    // 设置滤波方法参数
+    // 设置滤波方法参数，滤波器结构不变
     // @param filter_design butterworth滤波器设计类
     void set_coefficients(const ButterworthFilterDesign &filter_design)
     {
         filter_design.get_filter_coefficients(coefficients_a_, coefficients_b_);
+        filter_design.get_sos_coefficients(sos_coefficients_);
+        PrepareTransferFunction();
+        PrepareSos();
+    }
+
+    // 设置二阶节形式的滤波方法参数
+    // @param sos_coefficients 二阶节系数
+    void set_sos_coefficients(SosCoefficients sos_coefficients)
+    {
+        sos_coefficients_ = sos_coefficients;
+        structure_ = FilterStructure::second_order_sections;
+        PrepareSos();
+    }
+
+    // 设置滤波器结构
+    // @param structure 滤波器结构
+    void set_filter_structure(FilterStructure structure)
+    {
+        structure_ = structure;
     }
 
     // 矩阵滤波算法入口
@@ -102,14 +141,48 @@ public:
     std::vector<double>
     Filtering(const std::vector<double> &input_signal) override;
 
+    // 单列数据滤波算法入口，结果写入调用者提供的缓冲区
+    // @param input_signal 输入信号
+    // @param output_signal 滤波后的信号，尺寸自动调整为输入长度
+    // @note 信号长度不变时重复调用不分配内存（output_signal容量足够时）
+    void Filtering(const std::vector<double> &input_signal,
+                   std::vector<double> &output_signal);
+
 private:
-    // filtfilt滤波方法参数
+    // 滤波器结构
+    FilterStructure structure_{FilterStructure::transfer_function};
+    // filtfilt滤波方法参数（已归一化并补齐到相同长度）
     std::vector<double> coefficients_a_, coefficients_b_;
+    // 二阶节形式的filtfilt滤波方法参数（已归一化）
+    SosCoefficients sos_coefficients_{};
+    // 单位阶跃输入下的稳态初始条件，设置系数时计算
+    std::vector<double> zi_{}, sos_zi_{};
+    // 延拓后的信号和滤波器状态，重复调用时复用
+    // 由于工作区的存在，同一对象不能在多个线程中同时滤波
+    std::vector<double> signal_{}, state_{};
+
+    // 归一化传递函数系数并计算稳态初始条件
+    void PrepareTransferFunction();
+
+    // 归一化二阶节系数并计算稳态初始条件
+    void PrepareSos();
+
+    // 多通道同步filtfilt滤波，各通道长度相同
+    void MultichannelFiltering(
+        const std::vector<std::vector<double>> &input_signal,
+        std::vector<std::vector<double>> &output_signal);
+
+    // 计算单位阶跃输入下的稳态初始条件，并将系数补齐到相同长度
+    std::vector<double> SteadyStateCondition();
 
-    // filtfilt滤波算法的filter函数
-    void filter(const std::vector<double> &input_signal,
-                std::vector<double> &output_signal,
-                std::vector<double> zi);
+    // 将分母系数归一化为a[0] = 1
+    void NormalizeCoefficients();
+
+    // filtfilt滤波算法的filter函数，原位滤波
+    // @param signal 信号，滤波结果覆盖原信号
+    // @param size 信号长度
+    // @param state 滤波器状态，滤波后更新为末状态
+    void filter(double *signal, std::size_t size, double *state) const;
 
     // filtfilt算法的功能函数
     inline void
@@ -127,20 +200,6 @@ private:
         indices.resize(numel + indices.size(), value);
     }
 
-    inline void AppendVector(std::vector<double> &vec,
-                             const std::vector<double> &tail)
-    {
-        vec.insert(vec.end(), tail.begin(), tail.end());
-    }
-
-    inline std::vector<double>
-    SubvectorReverse(const std::vector<double> &vec, int idx_end, int idx_start)
-    {
-        std::vector<double> result(&vec[idx_start], &vec[idx_end + 1]);
-        std::reverse(result.begin(), result.end());
-        return result;
-    }
-
     inline int MaxVal(const std::vector<int> &vec)
     {
         return *std::max_element(vec.begin(), vec.end());
@@ -0,0 +1,221 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\frequency_filtering.cpp
+** -----
+** File Created: Friday, 16th October 2026 11:05:12
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 11:05:12
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：频域零相位滤波方法类的实现
+
+// associated header
+#include "frequency_filtering.h"
+
+// stdc++ headers
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <stdexcept>
+#include <vector>
+
+// third-party headers
+#include "fftw3.h"
+
+// project headers
+#include "fft_plan_cache.h"
+#include "scratch_arena.h"
+
+
+namespace numerical_algorithm
+{
+
+// 矩阵滤波算法入口
+std::vector<std::vector<double>>
+FrequencyFiltering::Filtering(
+    const std::vector<std::vector<double>> &input_signal)
+{
+    std::vector<std::vector<double>> output_signal(input_signal.size());
+    for (size_t i = 0; i < input_signal.size(); ++i)
+    {
+        output_signal[i] = Filtering(input_signal[i]);
+    }
+    return output_signal;
+}
+
+// 单列滤波算法入口
+std::vector<double>
+FrequencyFiltering::Filtering(const std::vector<double> &input_signal)
+{
+    SetSignal(input_signal);
+    std::vector<double> response, output_signal;
+    ZeroPhaseResponse(coefficients_a_, coefficients_b_, response);
+    Workspace workspace;
+    ApplyResponse(response, output_signal, workspace);
+    return output_signal;
+}
+
+// 设置待滤波的信号
+void FrequencyFiltering::SetSignal(const std::vector<double> &input_signal)
+{
+    if (input_signal.size() < 2)
+        throw std::domain_error(
+            "Input data too short! Data must have at least 2 points.");
+
+    // 1.确定延拓长度和FFT长度，FFT长度变化时从全局缓存中获取计划；
+    // 计划以FFTW_UNALIGNED创建，可用于各线程的任意工作区
+    signal_size_ = input_signal.size();
+    pad_size_ = pad_length_ < 0
+                    ? signal_size_ - 1
+                    : std::min<std::size_t>(pad_length_, signal_size_ - 1);
+    auto padded = MakeScratchVector(FastLength(signal_size_ + 2 * pad_size_));
+    if (padded.size() != fft_size_)
+    {
+        fft_size_ = padded.size();
+        spectrum_.resize(fft_size_ / 2 + 1);
+        auto &cache = FftPlanCache::Global();
+        forward_plan_ = cache.Get(fft_size_, FftDirection::forward, false);
+        backward_plan_ = cache.Get(fft_size_, FftDirection::backward, false);
+    }
+
+    // 2.两端奇对称延拓，与filtfilt的延拓方式相同，其余部分补零
+    double _2x0 = 2 * input_signal.front();
+    double _2xl = 2 * input_signal.back();
+    for (std::size_t i = 0; i < pad_size_; ++i)
+    {
+        padded[i] = _2x0 - input_signal[pad_size_ - i];
+        padded[pad_size_ + signal_size_ + i] =
+            _2xl - input_signal[signal_size_ - 2 - i];
+    }
+    std::copy(
+        input_signal.begin(), input_signal.end(), padded.begin() + pad_size_);
+
+    // 3.正向FFT
+    fftw_execute_dft_r2c(forward_plan_,
+                         padded.data(),
+                         reinterpret_cast<fftw_complex *>(spectrum_.data()));
+}
+
+// 计算滤波器在当前频谱各频点上的零相位响应
+void FrequencyFiltering::ZeroPhaseResponse(
+    const std::vector<double> &coefficients_a,
+    const std::vector<double> &coefficients_b,
+    std::vector<double> &response) const
+{
+    if (coefficients_a.empty() || coefficients_a.front() == 0)
+        throw std::domain_error(
+            "First feedback coefficient has to be non-zero.");
+    if (coefficients_b.empty())
+        throw std::domain_error("The feedforward filter coefficients are empty.");
+
+    // 在单位圆上用Horner法计算B(z)/A(z)，z^-1 = exp(-jw)
+    response.resize(spectrum_.size());
+    for (std::size_t i = 0; i < response.size(); ++i)
+    {
+        auto z = std::polar(1.0, -2 * M_PI * i / fft_size_);
+        std::complex<double> num = coefficients_b.back();
+        for (auto it = coefficients_b.rbegin() + 1; it != coefficients_b.rend();
+             ++it)
+        {
+            num = num * z + *it;
+        }
+        std::complex<double> den = coefficients_a.back();
+        for (auto it = coefficients_a.rbegin() + 1; it != coefficients_a.rend();
+             ++it)
+        {
+            den = den * z + *it;
+        }
+        response[i] = std::norm(num) / std::norm(den);
+    }
+}
+
+// 对当前信号施加实数响应并逆变换
+void FrequencyFiltering::ApplyResponse(const std::vector<double> &response,
+                                       std::vector<double> &output_signal,
+                                       Workspace &workspace,
+                                       int integral_order,
+                                       double time_step) const
+{
+    if (fft_size_ == 0)
+        throw std::runtime_error("No signal has been set.");
+    if (response.size() != spectrum_.size())
+        throw std::invalid_argument(
+            "The response size does not match the spectrum size.");
+    if (integral_order < 0)
+        throw std::invalid_argument("The integral order must be non-negative.");
+
+    // 1.施加响应，逆FFT的归一化系数合并到响应中
+    // 梯形积分的频率响应为 -j * dt / 2 * cot(w / 2)，直流分量舍弃
+    workspace.spectrum.resize(spectrum_.size());
+    workspace.signal.resize(fft_size_);
+    double scale = 1.0 / fft_size_;
+    for (std::size_t i = 0; i < spectrum_.size(); ++i)
+    {
+        double factor = response[i] * scale;
+        if (integral_order > 0)
+        {
+            factor = i == 0 ? 0.0
+                            : factor
+                                  * std::pow(time_step / 2
+                                                 / std::tan(M_PI * i
+                                                            / fft_size_),
+                                             integral_order);
+        }
+        auto value = spectrum_[i] * factor;
+        // 乘以(-j)^integral_order
+        switch (integral_order % 4)
+        {
+            case 1:
+                value = {value.imag(), -value.real()};
+                break;
+            case 2:
+                value = -value;
+                break;
+            case 3:
+                value = {-value.imag(), value.real()};
+                break;
+            default:
+                break;
+        }
+        workspace.spectrum[i] = value;
+    }
+
+    // 2.逆FFT并截取原信号区间
+    fftw_execute_dft_c2r(
+        backward_plan_,
+        reinterpret_cast<fftw_complex *>(workspace.spectrum.data()),
+        workspace.signal.data());
+    output_signal.assign(workspace.signal.begin() + pad_size_,
+                         workspace.signal.begin() + pad_size_ + signal_size_);
+}
+
+// 不小于n且仅含2、3、5、7因子的最小长度
+std::size_t FrequencyFiltering::FastLength(std::size_t n)
+{
+    for (std::size_t length = std::max<std::size_t>(n, 1);; ++length)
+    {
+        auto remain = length;
+        for (std::size_t factor : {2, 3, 5, 7})
+        {
+            while (remain % factor == 0)
+            {
+                remain /= factor;
+            }
+        }
+        if (remain == 1)
+        {
+            return length;
+        }
+    }
+}
+
+} // namespace numerical_algorithm
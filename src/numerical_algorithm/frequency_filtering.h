@@ -0,0 +1,164 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\frequency_filtering.h
+** -----
+** File Created: Friday, 16th October 2026 11:05:12
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 11:05:12
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：频域零相位滤波方法类
+// 对延拓后的信号做一次正向FFT，之后每组零相位响应|H|^2只需一次逆FFT，
+// 适用于同一信号需要在多组截止频率下滤波的场合
+
+#ifndef NUMERICAL_ALGORITHM_FREQUENCY_FILTERING_H_
+#define NUMERICAL_ALGORITHM_FREQUENCY_FILTERING_H_
+
+// stdc++ headers
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+// third-party headers
+#include "fftw3.h"
+
+// project headers
+#include "basic_filtering.h"
+#include "butterworth_filter_design.h"
+
+namespace numerical_algorithm
+{
+
+// 频域零相位滤波方法类
+class FrequencyFiltering : public BasicFiltering
+{
+public:
+    // 逆变换使用的线程私有工作区
+    struct Workspace
+    {
+        // 施加响应后的频谱（逆FFT会覆盖该缓冲区）
+        std::vector<std::complex<double>> spectrum{};
+        // 逆FFT得到的延拓信号
+        std::vector<double> signal{};
+    };
+
+    // 默认构造函数
+    FrequencyFiltering() = default;
+
+    // 由两个std::vector参数构造
+    // @param coefficients_a 滤波器分母系数
+    // @param coefficients_b 滤波器分子系数
+    FrequencyFiltering(std::vector<double> coefficients_a,
+                       std::vector<double> coefficients_b)
+        : coefficients_a_(coefficients_a), coefficients_b_(coefficients_b)
+    {}
+
+    // 由ButterworthFilterDesign参数构造
+    // @param filter_design butterworth滤波器设计类
+    FrequencyFiltering(const ButterworthFilterDesign &filter_design)
+    {
+        filter_design.get_filter_coefficients(coefficients_a_, coefficients_b_);
+    }
+
+    // 析构函数
+    ~FrequencyFiltering() = default;
+
+    // 设置滤波方法参数
+    // @param coefficients_a 滤波器分母系数
+    // @param coefficients_b 滤波器分子系数
+    void set_coefficients(std::vector<double> coefficients_a,
+                          std::vector<double> coefficients_b)
+    {
+        coefficients_a_ = coefficients_a;
+        coefficients_b_ = coefficients_b;
+    }
+
+    // 设置滤波方法参数
+    // @param filter_design butterworth滤波器设计类
+    void set_coefficients(const ButterworthFilterDesign &filter_design)
+    {
+        filter_design.get_filter_coefficients(coefficients_a_, coefficients_b_);
+    }
+
+    // 设置信号两端奇对称延拓的长度
+    // @param pad_length 延拓长度，负数表示延拓信号长度-1（最大延拓长度）
+    void set_pad_length(int pad_length) { pad_length_ = pad_length; }
+
+    // 获取当前信号的长度
+    std::size_t get_signal_size() const { return signal_size_; }
+
+    // 获取当前FFT的长度
+    std::size_t get_fft_size() const { return fft_size_; }
+
+    // 获取当前频谱的点数（fft_size / 2 + 1）
+    std::size_t get_spectrum_size() const { return spectrum_.size(); }
+
+    // 矩阵滤波算法入口
+    // @param input_signal 输入信号矩阵
+    // @return 滤波后的信号矩阵
+    std::vector<std::vector<double>>
+    Filtering(const std::vector<std::vector<double>> &input_signal) override;
+
+    // 单列数据滤波算法入口，以当前滤波器系数做零相位滤波
+    // @param input_signal 输入信号
+    // @return 滤波后的信号
+    // @note 会替换SetSignal设置的信号
+    std::vector<double>
+    Filtering(const std::vector<double> &input_signal) override;
+
+    // 设置待滤波的信号：奇对称延拓、补齐到FFT友好的长度并做正向FFT
+    // @param input_signal 输入信号
+    void SetSignal(const std::vector<double> &input_signal);
+
+    // 计算滤波器在当前频谱各频点上的零相位响应|H|^2
+    // @param coefficients_a 滤波器分母系数
+    // @param coefficients_b 滤波器分子系数
+    // @param response 零相位响应，尺寸自动调整为频谱点数
+    void ZeroPhaseResponse(const std::vector<double> &coefficients_a,
+                           const std::vector<double> &coefficients_b,
+                           std::vector<double> &response) const;
+
+    // 对当前信号施加实数响应并逆变换，可同时在频域做梯形积分
+    // @param response 实数频率响应，长度为频谱点数
+    // @param output_signal 输出信号，尺寸自动调整为输入信号长度
+    // @param workspace 线程私有的工作区
+    // @param integral_order 梯形积分次数，积分会舍弃直流分量
+    // @param time_step 积分步长
+    // @note 只读访问共享数据，不同线程使用不同工作区时可以并行调用
+    void ApplyResponse(const std::vector<double> &response,
+                       std::vector<double> &output_signal,
+                       Workspace &workspace,
+                       int integral_order = 0,
+                       double time_step = 1.0) const;
+
+    // 不小于n且仅含2、3、5、7因子的最小长度
+    // @param n 最小长度
+    // @return FFT友好的长度
+    static std::size_t FastLength(std::size_t n);
+
+private:
+    // 滤波器系数
+    std::vector<double> coefficients_a_{}, coefficients_b_{};
+    // 奇对称延拓的长度，负数表示延拓信号长度-1
+    int pad_length_{-1};
+
+    // 当前信号的长度、实际延拓长度和FFT长度
+    std::size_t signal_size_{0}, pad_size_{0}, fft_size_{0};
+    // 当前信号延拓后的频谱
+    std::vector<std::complex<double>> spectrum_{};
+    // 当前FFT长度的计划，由全局计划缓存持有，执行时不需要加锁
+    fftw_plan forward_plan_{nullptr}, backward_plan_{nullptr};
+};
+
+} // namespace numerical_algorithm
+
+#endif // NUMERICAL_ALGORITHM_FREQUENCY_FILTERING_H_
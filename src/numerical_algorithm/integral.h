@@ -40,6 +40,25 @@ inline std::vector<double> Cumtrapz(const std::vector<double> &input, double dx)
     return output;
 }
 
+// 梯形积分算法，结果写入调用者提供的缓冲区
+// @param input 输入数据（std::vector<double>、ScratchVector等）
+// @param dx 积分步长
+// @param output 积分结果，尺寸自动调整为输入长度
+template <typename Input, typename Output>
+inline void Cumtrapz(const Input &input, double dx, Output &output)
+{
+    output.resize(input.size());
+    if (input.empty())
+    {
+        return;
+    }
+    output[0] = 0.0;
+    for (size_t i = 1; i < input.size(); ++i)
+    {
+        output[i] = output[i - 1] + 0.5 * (input[i] + input[i - 1]) * dx;
+    }
+}
+
 // std::vector<std::vector<double>> 梯形积分算法（按列积分）
 // @param input 输入数据矩阵
 // @param output 积分结果矩阵
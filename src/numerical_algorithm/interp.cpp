@@ -22,6 +22,8 @@
 #include "interp.h"
 
 // stdc++ headers
+#include <algorithm>
+#include <cstddef>
 #include <stdexcept>
 #include <vector>
 
@@ -279,4 +281,93 @@ Interp::Interpolation(const std::vector<double> &x,
     return y_interp;
 }
 
+// 插值结果是否为已知点y坐标的线性函数
+bool Interp::IsLinear() const
+{
+    return interp_type_ == gsl_interp_linear
+           || interp_type_ == gsl_interp_cspline
+           || interp_type_ == gsl_interp_polynomial;
+}
+
+// 计算插值权重矩阵
+Eigen::MatrixXd Interp::InterpolationWeight(const std::vector<double> &x,
+                                            const std::vector<double> &x_interp)
+{
+    if (!IsLinear())
+    {
+        throw std::invalid_argument(
+            "The interpolation type is not linear in y.");
+    }
+    if (x.empty())
+    {
+        throw std::domain_error("Input point is empty.");
+    }
+
+    // 第j列为第j个已知点取1、其余取0时的插值结果
+    Eigen::MatrixXd weight(x_interp.size(), x.size());
+    x_ = x;
+    for (std::size_t j = 0; j < x.size(); ++j)
+    {
+        y_.assign(x.size(), 0.0);
+        y_[j] = 1.0;
+        auto column = Interpolation(x_interp);
+        for (std::size_t i = 0; i < x_interp.size(); ++i)
+        {
+            weight(i, j) = column[i];
+        }
+    }
+    return weight;
+}
+
+// 使用插值权重矩阵计算矩阵的插值结果
+std::vector<std::vector<double>>
+Interp::Interpolation(const Eigen::MatrixXd &weight,
+                      const std::vector<std::vector<double>> &y) const
+{
+    if (y.empty())
+    {
+        throw std::domain_error("Input point is empty.");
+    }
+    if (static_cast<Eigen::Index>(y.size()) != weight.cols())
+    {
+        throw std::invalid_argument(
+            "The size of y does not match the weight matrix.");
+    }
+
+    // 插值结果 = 权重矩阵 × 已知点矩阵（已知点的时程按行存储）
+    // 按时间分块计算，每块的已知点和结果矩阵都能放入缓存
+    using RowMatrix =
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    constexpr Eigen::Index kBlockSize = 512;
+    auto size = static_cast<Eigen::Index>(y.front().size());
+    for (const auto &row : y)
+    {
+        if (static_cast<Eigen::Index>(row.size()) != size)
+        {
+            throw std::invalid_argument("All rows of y must have equal size.");
+        }
+    }
+    std::vector<std::vector<double>> y_interp(weight.rows(),
+                                              std::vector<double>(size));
+    RowMatrix known(weight.cols(), kBlockSize);
+    RowMatrix result(weight.rows(), kBlockSize);
+    for (Eigen::Index start = 0; start < size; start += kBlockSize)
+    {
+        auto length = std::min(kBlockSize, size - start);
+        for (Eigen::Index j = 0; j < weight.cols(); ++j)
+        {
+            known.row(j).head(length) = Eigen::Map<const Eigen::RowVectorXd>(
+                y[j].data() + start, length);
+        }
+        result.leftCols(length).noalias() = weight * known.leftCols(length);
+        for (Eigen::Index i = 0; i < weight.rows(); ++i)
+        {
+            std::copy(result.row(i).data(),
+                      result.row(i).data() + length,
+                      y_interp[i].data() + start);
+        }
+    }
+    return y_interp;
+}
+
 } // namespace numerical_algorithm
\ No newline at end of file
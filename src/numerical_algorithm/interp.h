@@ -104,6 +104,26 @@ public:
                   const std::vector<std::vector<double>> &y,
                   const std::vector<double> &x_interp);
 
+    // 插值结果是否为已知点y坐标的线性函数（线性、三次样条和多项式插值）
+    // Akima和Steffen插值的斜率与y有关，不能表示为权重矩阵
+    // @return 插值结果为y的线性函数时返回true
+    bool IsLinear() const;
+
+    // 计算插值权重矩阵W，待插值点的y坐标为W * y，x坐标不变时可重复使用
+    // @param x 已知点的x坐标向量
+    // @param x_interp 待插值点的x坐标向量
+    // @return 权重矩阵，尺寸为待插值点数×已知点数
+    Eigen::MatrixXd InterpolationWeight(const std::vector<double> &x,
+                                        const std::vector<double> &x_interp);
+
+    // 使用插值权重矩阵计算矩阵的插值结果，全部时刻通过一次矩阵乘法计算
+    // @param weight 插值权重矩阵（见InterpolationWeight）
+    // @param y 已知点的y坐标矩阵
+    // @return 待插值点的插值结果y坐标矩阵
+    std::vector<std::vector<double>>
+    Interpolation(const Eigen::MatrixXd &weight,
+                  const std::vector<std::vector<double>> &y) const;
+
 private:
     // 插值算法的输入点
     std::vector<double> x_{}, y_{};
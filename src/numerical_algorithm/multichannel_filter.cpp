@@ -0,0 +1,457 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\multichannel_filter.cpp
+** -----
+** File Created: Friday, 16th October 2026 14:36:05
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 14:36:05
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：多通道同步IIR滤波核函数的实现
+// SIMD实现只使用乘法和加减法（不使用FMA），结果与标量实现逐位相同
+
+// associated header
+#include "multichannel_filter.h"
+
+// stdc++ headers
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+// x86-64平台使用AVX2/AVX-512实现，其他平台只使用标量实现
+#if defined(_M_X64) || defined(__x86_64__)
+#define NUMERICAL_ALGORITHM_X86_SIMD
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define NUMERICAL_ALGORITHM_TARGET_AVX2
+#define NUMERICAL_ALGORITHM_TARGET_AVX512
+#else
+// GCC在支持FMA的目标上会合并乘加运算，关闭以保证与标量实现结果相同
+#define NUMERICAL_ALGORITHM_TARGET_AVX2                                        \
+    __attribute__((target("avx2"), optimize("fp-contract=off")))
+#define NUMERICAL_ALGORITHM_TARGET_AVX512                                      \
+    __attribute__((target("avx512f"), optimize("fp-contract=off")))
+#endif
+#endif
+
+
+namespace numerical_algorithm
+{
+
+namespace
+{
+
+// SIMD实现支持的最大系数长度（4阶带通），更长时使用标量实现
+constexpr std::size_t kMaxSimdCoefficient = 9;
+
+// 标量实现：对[channel_begin, channel_end)范围内的通道逐样本同步滤波
+void FilterChannelsScalar(const double *a,
+                          const double *b,
+                          std::size_t n,
+                          const double *input,
+                          double *output,
+                          std::size_t sample_number,
+                          std::size_t channel_number,
+                          std::size_t channel_begin,
+                          std::size_t channel_end,
+                          double *state)
+{
+    for (std::size_t i = 0; i < sample_number; ++i)
+    {
+        const double *x_row = input + i * channel_number;
+        double *y_row = output + i * channel_number;
+        for (std::size_t c = channel_begin; c < channel_end; ++c)
+        {
+            double x = x_row[c];
+            if (n == 1)
+            {
+                y_row[c] = b[0] * x;
+                continue;
+            }
+            double y = b[0] * x + state[c];
+            for (std::size_t k = 1; k + 1 < n; ++k)
+            {
+                state[(k - 1) * channel_number + c] =
+                    b[k] * x - a[k] * y + state[k * channel_number + c];
+            }
+            state[(n - 2) * channel_number + c] = b[n - 1] * x - a[n - 1] * y;
+            y_row[c] = y;
+        }
+    }
+}
+
+#ifdef NUMERICAL_ALGORITHM_X86_SIMD
+
+// AVX2实现：系数长度为N，同时滤波从channel_begin开始的V组、每组4个通道，
+// 多组交替计算以掩盖递推的延迟
+template <std::size_t N, std::size_t V>
+NUMERICAL_ALGORITHM_TARGET_AVX2 void
+FilterBlockAvx2(const double *a,
+                const double *b,
+                const double *input,
+                double *output,
+                std::size_t sample_number,
+                std::size_t channel_number,
+                std::size_t channel_begin,
+                double *state)
+{
+    __m256d aa[N], bb[N], x[V], y[V], z[V][N - 1];
+    for (std::size_t k = 0; k < N; ++k)
+    {
+        aa[k] = _mm256_set1_pd(a[k]);
+        bb[k] = _mm256_set1_pd(b[k]);
+    }
+    for (std::size_t v = 0; v < V; ++v)
+    {
+        for (std::size_t k = 0; k + 1 < N; ++k)
+        {
+            z[v][k] = _mm256_loadu_pd(state + k * channel_number
+                                      + channel_begin + 4 * v);
+        }
+    }
+
+    for (std::size_t i = 0; i < sample_number; ++i)
+    {
+        std::size_t offset = i * channel_number + channel_begin;
+        for (std::size_t v = 0; v < V; ++v)
+        {
+            x[v] = _mm256_loadu_pd(input + offset + 4 * v);
+            y[v] = _mm256_add_pd(_mm256_mul_pd(bb[0], x[v]), z[v][0]);
+        }
+        for (std::size_t v = 0; v < V; ++v)
+        {
+            for (std::size_t k = 1; k + 1 < N; ++k)
+            {
+                z[v][k - 1] = _mm256_add_pd(
+                    _mm256_sub_pd(_mm256_mul_pd(bb[k], x[v]),
+                                  _mm256_mul_pd(aa[k], y[v])),
+                    z[v][k]);
+            }
+            z[v][N - 2] = _mm256_sub_pd(_mm256_mul_pd(bb[N - 1], x[v]),
+                                        _mm256_mul_pd(aa[N - 1], y[v]));
+            _mm256_storeu_pd(output + offset + 4 * v, y[v]);
+        }
+    }
+
+    for (std::size_t v = 0; v < V; ++v)
+    {
+        for (std::size_t k = 0; k + 1 < N; ++k)
+        {
+            _mm256_storeu_pd(
+                state + k * channel_number + channel_begin + 4 * v, z[v][k]);
+        }
+    }
+}
+
+// AVX-512实现：系数长度为N，同时滤波从channel_begin开始的V组、每组8个通道
+template <std::size_t N, std::size_t V>
+NUMERICAL_ALGORITHM_TARGET_AVX512 void
+FilterBlockAvx512(const double *a,
+                  const double *b,
+                  const double *input,
+                  double *output,
+                  std::size_t sample_number,
+                  std::size_t channel_number,
+                  std::size_t channel_begin,
+                  double *state)
+{
+    __m512d aa[N], bb[N], x[V], y[V], z[V][N - 1];
+    for (std::size_t k = 0; k < N; ++k)
+    {
+        aa[k] = _mm512_set1_pd(a[k]);
+        bb[k] = _mm512_set1_pd(b[k]);
+    }
+    for (std::size_t v = 0; v < V; ++v)
+    {
+        for (std::size_t k = 0; k + 1 < N; ++k)
+        {
+            z[v][k] = _mm512_loadu_pd(state + k * channel_number
+                                      + channel_begin + 8 * v);
+        }
+    }
+
+    for (std::size_t i = 0; i < sample_number; ++i)
+    {
+        std::size_t offset = i * channel_number + channel_begin;
+        for (std::size_t v = 0; v < V; ++v)
+        {
+            x[v] = _mm512_loadu_pd(input + offset + 8 * v);
+            y[v] = _mm512_add_pd(_mm512_mul_pd(bb[0], x[v]), z[v][0]);
+        }
+        for (std::size_t v = 0; v < V; ++v)
+        {
+            for (std::size_t k = 1; k + 1 < N; ++k)
+            {
+                z[v][k - 1] = _mm512_add_pd(
+                    _mm512_sub_pd(_mm512_mul_pd(bb[k], x[v]),
+                                  _mm512_mul_pd(aa[k], y[v])),
+                    z[v][k]);
+            }
+            z[v][N - 2] = _mm512_sub_pd(_mm512_mul_pd(bb[N - 1], x[v]),
+                                        _mm512_mul_pd(aa[N - 1], y[v]));
+            _mm512_storeu_pd(output + offset + 8 * v, y[v]);
+        }
+    }
+
+    for (std::size_t v = 0; v < V; ++v)
+    {
+        for (std::size_t k = 0; k + 1 < N; ++k)
+        {
+            _mm512_storeu_pd(
+                state + k * channel_number + channel_begin + 8 * v, z[v][k]);
+        }
+    }
+}
+
+// 多通道滤波核函数的参数
+struct BlockArgument
+{
+    const double *a, *b, *input;
+    double *output;
+    std::size_t sample_number, channel_number, channel_begin;
+    double *state;
+};
+
+// 按系数长度选择固定长度的实现
+template <std::size_t V, std::size_t N = 2>
+void FilterBlock(SimdLevel level, std::size_t n, const BlockArgument &arg)
+{
+    if (n != N)
+    {
+        if constexpr (N < kMaxSimdCoefficient)
+        {
+            FilterBlock<V, N + 1>(level, n, arg);
+        }
+        return;
+    }
+    if (level == SimdLevel::avx512)
+    {
+        FilterBlockAvx512<N, V>(arg.a,
+                                arg.b,
+                                arg.input,
+                                arg.output,
+                                arg.sample_number,
+                                arg.channel_number,
+                                arg.channel_begin,
+                                arg.state);
+    }
+    else
+    {
+        FilterBlockAvx2<N, V>(arg.a,
+                              arg.b,
+                              arg.input,
+                              arg.output,
+                              arg.sample_number,
+                              arg.channel_number,
+                              arg.channel_begin,
+                              arg.state);
+    }
+}
+
+#endif // NUMERICAL_ALGORITHM_X86_SIMD
+
+} // namespace
+
+// 检测当前CPU和操作系统支持的最高SIMD指令集级别
+SimdLevel DetectSimdLevel()
+{
+    static const SimdLevel level = [] {
+#if defined(NUMERICAL_ALGORITHM_X86_SIMD) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7)
+        {
+            return SimdLevel::scalar;
+        }
+        // 需要操作系统通过XSAVE保存YMM/ZMM寄存器
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        if (!osxsave)
+        {
+            return SimdLevel::scalar;
+        }
+        unsigned long long xcr0 = _xgetbv(0);
+        __cpuidex(info, 7, 0);
+        bool avx2 = (info[1] & (1 << 5)) != 0;
+        bool avx512f = (info[1] & (1 << 16)) != 0;
+        if (avx512f && (xcr0 & 0xE6) == 0xE6)
+        {
+            return SimdLevel::avx512;
+        }
+        if (avx2 && (xcr0 & 0x6) == 0x6)
+        {
+            return SimdLevel::avx2;
+        }
+        return SimdLevel::scalar;
+#elif defined(NUMERICAL_ALGORITHM_X86_SIMD)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+        {
+            return SimdLevel::avx512;
+        }
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return SimdLevel::avx2;
+        }
+        return SimdLevel::scalar;
+#else
+        return SimdLevel::scalar;
+#endif
+    }();
+    return level;
+}
+
+// 将按通道存储的矩阵转换为交错存储
+void Interleave(const std::vector<std::vector<double>> &channels,
+                ScratchVector &interleaved)
+{
+    std::size_t channel_number = channels.size();
+    std::size_t sample_number = channels.empty() ? 0 : channels.front().size();
+    interleaved.resize(channel_number * sample_number);
+    for (const auto &channel : channels)
+    {
+        if (channel.size() != sample_number)
+            throw std::invalid_argument(
+                "All channels must have the same length.");
+    }
+    // 按样本顺序写入，使写操作连续
+    for (std::size_t i = 0; i < sample_number; ++i)
+    {
+        double *row = interleaved.data() + i * channel_number;
+        for (std::size_t c = 0; c < channel_number; ++c)
+        {
+            row[c] = channels[c][i];
+        }
+    }
+}
+
+// 将交错存储的数据转换为按通道存储的矩阵
+void Deinterleave(const ScratchVector &interleaved,
+                  std::size_t channel_number,
+                  std::vector<std::vector<double>> &channels)
+{
+    std::size_t sample_number =
+        channel_number == 0 ? 0 : interleaved.size() / channel_number;
+    channels.resize(channel_number);
+    for (auto &channel : channels)
+    {
+        channel.resize(sample_number);
+    }
+    // 按样本顺序读取，使读操作连续
+    for (std::size_t i = 0; i < sample_number; ++i)
+    {
+        const double *row = interleaved.data() + i * channel_number;
+        for (std::size_t c = 0; c < channel_number; ++c)
+        {
+            channels[c][i] = row[c];
+        }
+    }
+}
+
+// 多通道直接II型转置结构IIR滤波
+void MultichannelFilter(const std::vector<double> &coefficients_a,
+                        const std::vector<double> &coefficients_b,
+                        const double *input,
+                        double *output,
+                        std::size_t sample_number,
+                        std::size_t channel_number,
+                        double *state,
+                        SimdLevel level)
+{
+    std::size_t n = coefficients_b.size();
+    if (n == 0 || coefficients_a.size() != n)
+        throw std::invalid_argument(
+            "The filter coefficients must be non-empty and of equal length.");
+    if (coefficients_a.front() != 1.0)
+        throw std::domain_error(
+            "The feedback coefficients must be normalized (a[0] == 1).");
+    const double *a = coefficients_a.data();
+    const double *b = coefficients_b.data();
+    level = std::min(level, DetectSimdLevel());
+    if (n < 2 || n > kMaxSimdCoefficient)
+    {
+        level = SimdLevel::scalar;
+    }
+
+    // 按SIMD宽度分块，每次尽量处理两组，剩余通道使用较窄的实现
+    std::size_t c = 0;
+#ifdef NUMERICAL_ALGORITHM_X86_SIMD
+    BlockArgument arg{
+        a, b, input, output, sample_number, channel_number, 0, state};
+    for (auto block_level : {SimdLevel::avx512, SimdLevel::avx2})
+    {
+        if (level < block_level)
+        {
+            continue;
+        }
+        std::size_t width = block_level == SimdLevel::avx512 ? 8 : 4;
+        for (; c + 2 * width <= channel_number; c += 2 * width)
+        {
+            arg.channel_begin = c;
+            FilterBlock<2>(block_level, n, arg);
+        }
+        for (; c + width <= channel_number; c += width)
+        {
+            arg.channel_begin = c;
+            FilterBlock<1>(block_level, n, arg);
+        }
+    }
+#endif
+    if (c < channel_number)
+    {
+        FilterChannelsScalar(a,
+                             b,
+                             n,
+                             input,
+                             output,
+                             sample_number,
+                             channel_number,
+                             c,
+                             channel_number,
+                             state);
+    }
+}
+
+// 多通道二阶节级联滤波，逐节处理整个交错信号
+void MultichannelSosFilter(const SosCoefficients &sos,
+                           const double *input,
+                           double *output,
+                           std::size_t sample_number,
+                           std::size_t channel_number,
+                           double *state,
+                           SimdLevel level)
+{
+    if (sos.empty())
+    {
+        std::copy(
+            input, input + sample_number * channel_number, output);
+        return;
+    }
+    std::vector<double> a(3), b(3);
+    for (std::size_t s = 0; s < sos.size(); ++s)
+    {
+        std::copy(sos[s].begin(), sos[s].begin() + 3, b.begin());
+        std::copy(sos[s].begin() + 3, sos[s].end(), a.begin());
+        MultichannelFilter(a,
+                           b,
+                           s == 0 ? input : output,
+                           output,
+                           sample_number,
+                           channel_number,
+                           state + 2 * s * channel_number,
+                           level);
+    }
+}
+
+} // namespace numerical_algorithm
@@ -0,0 +1,102 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\multichannel_filter.h
+** -----
+** File Created: Friday, 16th October 2026 14:36:05
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 14:36:05
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：多通道同步IIR滤波核函数
+// 各通道共用滤波器系数，数据按通道交错存储（第i个样本的第c个通道位于
+// data[i * channel_number + c]），递推在样本方向进行，同一时刻的多个通道
+// 放在SIMD寄存器的不同分量中同时计算；运行时根据CPU选择AVX-512/AVX2/标量实现
+
+#ifndef NUMERICAL_ALGORITHM_MULTICHANNEL_FILTER_H_
+#define NUMERICAL_ALGORITHM_MULTICHANNEL_FILTER_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <vector>
+
+// project headers
+#include "scratch_arena.h"
+#include "sos_filter.h"
+
+
+namespace numerical_algorithm
+{
+
+// SIMD指令集级别
+enum class SimdLevel
+{
+    scalar,
+    avx2,
+    avx512
+};
+
+// 检测当前CPU和操作系统支持的最高SIMD指令集级别（仅检测一次）
+SimdLevel DetectSimdLevel();
+
+// 将按通道存储的矩阵转换为交错存储
+// @param channels 按通道存储的数据，各通道长度相同
+// @param interleaved 交错存储的数据（临时向量）
+void Interleave(const std::vector<std::vector<double>> &channels,
+                ScratchVector &interleaved);
+
+// 将交错存储的数据转换为按通道存储的矩阵
+// @param interleaved 交错存储的数据
+// @param channel_number 通道数
+// @param channels 按通道存储的数据
+void Deinterleave(const ScratchVector &interleaved,
+                  std::size_t channel_number,
+                  std::vector<std::vector<double>> &channels);
+
+// 多通道直接II型转置结构IIR滤波，与FiltFilt单通道滤波的运算顺序相同
+// @param coefficients_a 滤波器分母系数（a0 = 1），长度与分子系数相同
+// @param coefficients_b 滤波器分子系数
+// @param input 交错存储的输入信号
+// @param output 交错存储的输出信号，可以与输入相同
+// @param sample_number 每个通道的样本数
+// @param channel_number 通道数
+// @param state 各通道状态，第k个状态的第c个通道位于state[k * channel_number + c]，
+//        共(系数长度 - 1)个状态，滤波后更新为末状态
+// @param level 使用的SIMD指令集级别，不超过DetectSimdLevel()的结果
+void MultichannelFilter(const std::vector<double> &coefficients_a,
+                        const std::vector<double> &coefficients_b,
+                        const double *input,
+                        double *output,
+                        std::size_t sample_number,
+                        std::size_t channel_number,
+                        double *state,
+                        SimdLevel level = DetectSimdLevel());
+
+// 多通道二阶节级联滤波
+// @param sos 二阶节系数（已归一化）
+// @param input 交错存储的输入信号
+// @param output 交错存储的输出信号，可以与输入相同
+// @param sample_number 每个通道的样本数
+// @param channel_number 通道数
+// @param state 各通道状态，第s节第k个状态的第c个通道位于
+//        state[(2 * s + k) * channel_number + c]，滤波后更新为末状态
+// @param level 使用的SIMD指令集级别，不超过DetectSimdLevel()的结果
+void MultichannelSosFilter(const SosCoefficients &sos,
+                           const double *input,
+                           double *output,
+                           std::size_t sample_number,
+                           std::size_t channel_number,
+                           double *state,
+                           SimdLevel level = DetectSimdLevel());
+
+} // namespace numerical_algorithm
+
+#endif // NUMERICAL_ALGORITHM_MULTICHANNEL_FILTER_H_
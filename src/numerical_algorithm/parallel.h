@@ -0,0 +1,119 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\parallel.h
+** -----
+** File Created: Friday, 16th October 2026 10:12:40
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 10:12:40
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：简单的并行循环工具，将互相独立的任务分配到多个线程上执行
+
+#ifndef NUMERICAL_ALGORITHM_PARALLEL_H_
+#define NUMERICAL_ALGORITHM_PARALLEL_H_
+
+// stdc++ headers
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace numerical_algorithm
+{
+
+// 获取默认的工作线程数量（硬件线程数，至少为1）
+inline std::size_t DefaultThreadNumber()
+{
+    auto thread_number = std::thread::hardware_concurrency();
+    return thread_number == 0 ? 1 : thread_number;
+}
+
+// 获取实际使用的线程数量
+// @param task_number 任务数量
+// @param thread_number 期望的线程数量，0表示使用硬件线程数
+// @return 实际使用的线程数量，不超过任务数量
+inline std::size_t ActualThreadNumber(std::size_t task_number,
+                                      std::size_t thread_number = 0)
+{
+    if (thread_number == 0)
+    {
+        thread_number = DefaultThreadNumber();
+    }
+    return std::max<std::size_t>(1, std::min(thread_number, task_number));
+}
+
+// 并行执行[0, task_number)区间内的任务，任务按序号动态分配给各线程
+// @param task_number 任务数量
+// @param func 任务函数，参数为(任务序号, 线程序号)，线程序号可用于索引线程私有的工作区
+// @param thread_number 线程数量，0表示使用硬件线程数
+// @note 任一任务抛出的第一个异常会在所有线程结束后重新抛出
+template <typename Function>
+void ParallelFor(std::size_t task_number,
+                 Function &&func,
+                 std::size_t thread_number = 0)
+{
+    thread_number = ActualThreadNumber(task_number, thread_number);
+    if (thread_number == 1)
+    {
+        for (std::size_t i = 0; i != task_number; ++i)
+        {
+            func(i, std::size_t{0});
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next_task{0};
+    std::exception_ptr exception = nullptr;
+    std::mutex exception_mutex;
+    auto worker = [&](std::size_t thread_index) {
+        try
+        {
+            for (std::size_t i = next_task++; i < task_number; i = next_task++)
+            {
+                func(i, thread_index);
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+            next_task = task_number;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(thread_number - 1);
+    for (std::size_t t = 1; t != thread_number; ++t)
+    {
+        threads.emplace_back(worker, t);
+    }
+    worker(0);
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+} // namespace numerical_algorithm
+
+#endif // NUMERICAL_ALGORITHM_PARALLEL_H_
@@ -0,0 +1,106 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\scratch_arena.cpp
+** -----
+** File Created: Saturday, 17th October 2026 20:03:51
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 20:03:51
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：单次事件分析的临时内存池的实现
+
+// associated header
+#include "scratch_arena.h"
+
+// stdc++ headers
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+
+namespace numerical_algorithm
+{
+
+namespace
+{
+// 当前线程安装的内存池，未安装时为空
+thread_local ScratchArena *current_arena = nullptr;
+} // namespace
+
+// 由初始块大小构造
+ScratchArena::ScratchArena(std::size_t initial_size)
+    : initial_size_(initial_size),
+      initial_buffer_(initial_size > 0 ? new std::byte[initial_size]
+                                       : nullptr),
+      monotonic_(initial_buffer_.get(), initial_size_, &upstream_)
+{}
+
+// 一次释放全部分配
+void ScratchArena::Release()
+{
+    monotonic_.release();
+    allocated_ = 0;
+    upstream_.count_ = 0;
+}
+
+// 从单调内存资源中分配
+void *ScratchArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    allocated_ += bytes;
+    return monotonic_.allocate(bytes, alignment);
+}
+
+// 向堆申请内存并计数
+void *ScratchArena::UpstreamResource::do_allocate(std::size_t bytes,
+                                                  std::size_t alignment)
+{
+    ++count_;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+// 归还堆内存
+void ScratchArena::UpstreamResource::do_deallocate(void *pointer,
+                                                   std::size_t bytes,
+                                                   std::size_t alignment)
+{
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+}
+
+// 安装内存池
+ScratchScope::ScratchScope(ScratchArena &arena)
+    : arena_(arena), previous_(current_arena)
+{
+    current_arena = &arena;
+    ++arena_.scope_depth_;
+}
+
+// 恢复之前的内存池
+ScratchScope::~ScratchScope()
+{
+    current_arena = previous_;
+    if (--arena_.scope_depth_ == 0)
+    {
+        arena_.Release();
+    }
+}
+
+// 获取当前线程的临时内存资源
+std::pmr::memory_resource *GetScratchResource()
+{
+    if (current_arena != nullptr)
+    {
+        return current_arena;
+    }
+    return std::pmr::new_delete_resource();
+}
+
+} // namespace numerical_algorithm
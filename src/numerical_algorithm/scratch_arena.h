@@ -0,0 +1,152 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\scratch_arena.h
+** -----
+** File Created: Saturday, 17th October 2026 20:03:51
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 20:03:51
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：单次事件分析的临时内存池（基于std::pmr）
+// 一次事件分析（异常检测、FI/MFI、安全评估、地震动参数）中的临时向量从单调
+// 内存池中顺序分配，释放为空操作，事件结束时一次全部回收。用法：
+//   numerical_algorithm::ScratchArena arena;
+//   {
+//       numerical_algorithm::ScratchScope scope(arena);
+//       ... // 本线程内的临时向量（ScratchVector）从arena中分配
+//   }   // 作用域结束时一次释放
+// 内存池按线程安装，并行处理多个事件时各线程使用各自的内存池，互不竞争。
+// 内存池本身不是线程安全的：临时向量只能在创建它的线程中改变大小，并且不能
+// 在作用域结束后继续使用。
+
+#ifndef NUMERICAL_ALGORITHM_SCRATCH_ARENA_H_
+#define NUMERICAL_ALGORITHM_SCRATCH_ARENA_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+
+namespace numerical_algorithm
+{
+
+// 内存池初始块的默认大小（字节）
+constexpr std::size_t kDefaultScratchSize = std::size_t(4) << 20;
+
+// 从当前线程的内存池中分配的临时向量
+using ScratchVector = std::pmr::vector<double>;
+
+// 单次事件分析的单调内存池
+class ScratchArena : public std::pmr::memory_resource
+{
+public:
+    // 由初始块大小构造，初始块用尽后向堆申请更大的块
+    // @param initial_size 初始块大小（字节）
+    explicit ScratchArena(std::size_t initial_size = kDefaultScratchSize);
+
+    // 禁止复制
+    ScratchArena(const ScratchArena &) = delete;
+    ScratchArena &operator=(const ScratchArena &) = delete;
+
+    // 析构函数
+    ~ScratchArena() override = default;
+
+    // 一次释放全部分配，保留初始块供下一次事件使用
+    void Release();
+
+    // 获取自上次释放以来分配的字节数
+    // @return 分配的字节数
+    std::size_t get_allocated() const { return allocated_; }
+
+    // 获取自上次释放以来向堆申请内存的次数，初始块足够时为0
+    // @return 向堆申请内存的次数
+    std::size_t get_upstream_count() const { return upstream_.count_; }
+
+private:
+    friend class ScratchScope;
+
+    // 向堆申请内存并计数的上游内存资源
+    struct UpstreamResource : public std::pmr::memory_resource
+    {
+        std::size_t count_{};
+
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void *pointer,
+                           std::size_t bytes,
+                           std::size_t alignment) override;
+        bool
+        do_is_equal(const std::pmr::memory_resource &other) const
+            noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    // 初始块
+    std::size_t initial_size_{};
+    std::unique_ptr<std::byte[]> initial_buffer_{};
+    // 上游内存资源和单调内存资源
+    UpstreamResource upstream_{};
+    std::pmr::monotonic_buffer_resource monotonic_;
+    // 自上次释放以来分配的字节数
+    std::size_t allocated_{};
+    // 使用该内存池的ScratchScope的嵌套层数
+    std::size_t scope_depth_{};
+
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void *, std::size_t, std::size_t) override {}
+    bool
+    do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+// 在当前线程中安装内存池的作用域，可以嵌套
+class ScratchScope
+{
+public:
+    // 安装内存池，此后本线程的临时向量从该内存池中分配
+    // @param arena 内存池
+    explicit ScratchScope(ScratchArena &arena);
+
+    // 禁止复制
+    ScratchScope(const ScratchScope &) = delete;
+    ScratchScope &operator=(const ScratchScope &) = delete;
+
+    // 恢复之前的内存池；该内存池的最外层作用域结束时一次释放全部分配
+    ~ScratchScope();
+
+private:
+    ScratchArena &arena_;
+    ScratchArena *previous_{};
+};
+
+// 获取当前线程的临时内存资源，不在ScratchScope中时为堆内存
+// @return 临时内存资源
+std::pmr::memory_resource *GetScratchResource();
+
+// 从当前线程的临时内存资源中分配临时向量
+// @param size 向量长度
+// @param value 初始值
+// @return 临时向量
+inline ScratchVector MakeScratchVector(std::size_t size = 0,
+                                       double value = 0.0)
+{
+    return ScratchVector(size, value, GetScratchResource());
+}
+
+} // namespace numerical_algorithm
+
+#endif // NUMERICAL_ALGORITHM_SCRATCH_ARENA_H_
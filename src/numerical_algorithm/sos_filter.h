@@ -0,0 +1,202 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\sos_filter.h
+** -----
+** File Created: Friday, 16th October 2026 13:20:47
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 13:20:47
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：二阶节（biquad）级联滤波器的系数表示和滤波核函数
+// 采用直接II型转置结构，每节2个状态变量
+
+#ifndef NUMERICAL_ALGORITHM_SOS_FILTER_H_
+#define NUMERICAL_ALGORITHM_SOS_FILTER_H_
+
+// stdc++ headers
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+
+namespace numerical_algorithm
+{
+
+// 二阶节系数：{b0, b1, b2, a0, a1, a2}，与MATLAB/SciPy的sos矩阵行相同
+using SecondOrderSection = std::array<double, 6>;
+
+// 二阶节级联滤波器系数
+using SosCoefficients = std::vector<SecondOrderSection>;
+
+// 将各节系数按a0归一化
+// @param sos 二阶节系数
+inline void NormalizeSos(SosCoefficients &sos)
+{
+    for (auto &section : sos)
+    {
+        double a0 = section[3];
+        if (a0 == 0)
+            throw std::domain_error(
+                "First feedback coefficient has to be non-zero.");
+        for (auto &coefficient : section)
+        {
+            coefficient /= a0;
+        }
+    }
+}
+
+// 单位阶跃输入下二阶节级联的稳态初始条件，与SciPy的sosfilt_zi相同
+// @param sos 二阶节系数（已归一化）
+// @param zi 初始条件，每节2个，尺寸自动调整为2倍节数
+inline void SosInitialState(const SosCoefficients &sos, std::vector<double> &zi)
+{
+    zi.resize(2 * sos.size());
+    // 前面各节的稳态增益，即本节的稳态输入
+    double scale = 1.0;
+    for (std::size_t s = 0; s < sos.size(); ++s)
+    {
+        const auto &c = sos[s];
+        double gain = (c[0] + c[1] + c[2]) / (1.0 + c[4] + c[5]);
+        zi[2 * s + 1] = (c[2] - c[5] * gain) * scale;
+        zi[2 * s] = (c[1] + c[2] - (c[4] + c[5]) * gain) * scale;
+        scale *= gain;
+    }
+}
+
+// 固定节数的二阶节级联滤波，系数和状态保存在局部变量中
+// @param sos 二阶节系数（已归一化），共Sections节
+// @param input 输入信号
+// @param output 输出信号，可以与输入相同
+// @param size 信号长度
+// @param state 各节状态，每节2个，滤波后更新为末状态
+template <std::size_t Sections>
+void SosFilterFixed(const SecondOrderSection *sos,
+                    const double *input,
+                    double *output,
+                    std::size_t size,
+                    double *state)
+{
+    std::array<double, Sections> b0, b1, b2, a1, a2, z0, z1;
+    for (std::size_t s = 0; s < Sections; ++s)
+    {
+        b0[s] = sos[s][0];
+        b1[s] = sos[s][1];
+        b2[s] = sos[s][2];
+        a1[s] = sos[s][4];
+        a2[s] = sos[s][5];
+        z0[s] = state[2 * s];
+        z1[s] = state[2 * s + 1];
+    }
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        double x = input[i];
+        for (std::size_t s = 0; s < Sections; ++s)
+        {
+            double y = b0[s] * x + z0[s];
+            z0[s] = b1[s] * x - a1[s] * y + z1[s];
+            z1[s] = b2[s] * x - a2[s] * y;
+            x = y;
+        }
+        output[i] = x;
+    }
+    for (std::size_t s = 0; s < Sections; ++s)
+    {
+        state[2 * s] = z0[s];
+        state[2 * s + 1] = z1[s];
+    }
+}
+
+// 二阶节级联滤波（直接II型转置结构）
+// @param sos 二阶节系数（已归一化）
+// @param input 输入信号
+// @param output 输出信号，可以与输入相同
+// @param size 信号长度
+// @param state 各节状态，每节2个，滤波后更新为末状态
+// @note 1~8节（4~16阶带通）使用固定节数的实现，更多节时逐节处理整个信号
+inline void SosFilter(const SosCoefficients &sos,
+                      const double *input,
+                      double *output,
+                      std::size_t size,
+                      double *state)
+{
+    switch (sos.size())
+    {
+        case 0:
+            std::copy(input, input + size, output);
+            return;
+        case 1:
+            SosFilterFixed<1>(sos.data(), input, output, size, state);
+            return;
+        case 2:
+            SosFilterFixed<2>(sos.data(), input, output, size, state);
+            return;
+        case 3:
+            SosFilterFixed<3>(sos.data(), input, output, size, state);
+            return;
+        case 4:
+            SosFilterFixed<4>(sos.data(), input, output, size, state);
+            return;
+        case 5:
+            SosFilterFixed<5>(sos.data(), input, output, size, state);
+            return;
+        case 6:
+            SosFilterFixed<6>(sos.data(), input, output, size, state);
+            return;
+        case 7:
+            SosFilterFixed<7>(sos.data(), input, output, size, state);
+            return;
+        case 8:
+            SosFilterFixed<8>(sos.data(), input, output, size, state);
+            return;
+        default:
+            break;
+    }
+    for (std::size_t s = 0; s < sos.size(); ++s)
+    {
+        const double *x = s == 0 ? input : output;
+        double b0 = sos[s][0], b1 = sos[s][1], b2 = sos[s][2];
+        double a1 = sos[s][4], a2 = sos[s][5];
+        double z0 = state[2 * s], z1 = state[2 * s + 1];
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            double y = b0 * x[i] + z0;
+            z0 = b1 * x[i] - a1 * y + z1;
+            z1 = b2 * x[i] - a2 * y;
+            output[i] = y;
+        }
+        state[2 * s] = z0;
+        state[2 * s + 1] = z1;
+    }
+}
+
+// 二阶节级联滤波，从零状态开始
+// @param sos 二阶节系数（已归一化）
+// @param input_signal 输入信号
+// @param output_signal 输出信号，尺寸自动调整为输入长度
+inline void SosFilter(const SosCoefficients &sos,
+                      const std::vector<double> &input_signal,
+                      std::vector<double> &output_signal)
+{
+    std::vector<double> state(2 * sos.size(), 0.0);
+    output_signal.resize(input_signal.size());
+    SosFilter(sos,
+              input_signal.data(),
+              output_signal.data(),
+              input_signal.size(),
+              state.data());
+}
+
+} // namespace numerical_algorithm
+
+#endif // NUMERICAL_ALGORITHM_SOS_FILTER_H_
@@ -0,0 +1,205 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\streaming_filter.cpp
+** -----
+** File Created: Friday, 16th October 2026 15:42:18
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 15:42:18
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：流式滤波方法类的实现
+
+// associated header
+#include "streaming_filter.h"
+
+// stdc++ headers
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+// project headers
+#include "multichannel_filter.h"
+
+
+namespace numerical_algorithm
+{
+
+// 由两个std::vector参数构造
+StreamingFilter::StreamingFilter(std::vector<double> coefficients_a,
+                                 std::vector<double> coefficients_b,
+                                 std::size_t channel_number)
+    : structure_(FilterStructure::transfer_function),
+      coefficients_a_(coefficients_a), coefficients_b_(coefficients_b),
+      channel_number_(channel_number)
+{
+    Initialize();
+}
+
+// 由二阶节系数构造
+StreamingFilter::StreamingFilter(SosCoefficients sos_coefficients,
+                                 std::size_t channel_number)
+    : structure_(FilterStructure::second_order_sections),
+      sos_coefficients_(sos_coefficients), channel_number_(channel_number)
+{
+    Initialize();
+}
+
+// 由butterworth滤波器设计构造
+StreamingFilter::StreamingFilter(const ButterworthFilterDesign &filter_design,
+                                 FilterStructure structure,
+                                 std::size_t channel_number)
+    : structure_(structure), channel_number_(channel_number)
+{
+    if (structure_ == FilterStructure::second_order_sections)
+    {
+        filter_design.get_sos_coefficients(sos_coefficients_);
+    }
+    else
+    {
+        filter_design.get_filter_coefficients(coefficients_a_,
+                                              coefficients_b_);
+    }
+    Initialize();
+}
+
+// 滤波一块信号
+void StreamingFilter::Process(const double *input,
+                              double *output,
+                              std::size_t sample_number)
+{
+    if (sample_number == 0)
+    {
+        return;
+    }
+    if (structure_ == FilterStructure::second_order_sections)
+    {
+        // 单通道时使用固定节数的二阶节实现
+        if (channel_number_ == 1)
+        {
+            SosFilter(sos_coefficients_,
+                      input,
+                      output,
+                      sample_number,
+                      state_.data());
+        }
+        else
+        {
+            MultichannelSosFilter(sos_coefficients_,
+                                  input,
+                                  output,
+                                  sample_number,
+                                  channel_number_,
+                                  state_.data());
+        }
+        return;
+    }
+    MultichannelFilter(coefficients_a_,
+                       coefficients_b_,
+                       input,
+                       output,
+                       sample_number,
+                       channel_number_,
+                       state_.data());
+}
+
+// 滤波一块信号，结果写入调用者提供的缓冲区
+void StreamingFilter::Process(const std::vector<double> &input,
+                              std::vector<double> &output)
+{
+    if (input.size() % channel_number_ != 0)
+        throw std::invalid_argument(
+            "The input size must be a multiple of the channel number.");
+    output.resize(input.size());
+    Process(input.data(), output.data(), input.size() / channel_number_);
+}
+
+// 将滤波器状态清零
+void StreamingFilter::Reset()
+{
+    std::fill(state_.begin(), state_.end(), 0.0);
+}
+
+// 将滤波器状态设为输入恒定时的稳态
+void StreamingFilter::ResetSteadyState(const std::vector<double> &value)
+{
+    if (value.size() != channel_number_)
+        throw std::invalid_argument(
+            "The number of values must equal the channel number.");
+    for (std::size_t k = 0; k < steady_state_.size(); ++k)
+    {
+        for (std::size_t c = 0; c < channel_number_; ++c)
+        {
+            state_[k * channel_number_ + c] = steady_state_[k] * value[c];
+        }
+    }
+}
+
+// 设置滤波器状态
+void StreamingFilter::set_state(const std::vector<double> &state)
+{
+    if (state.size() != state_.size())
+        throw std::invalid_argument(
+            "The state size does not match the filter.");
+    state_ = state;
+}
+
+// 归一化系数，计算稳态状态并分配状态存储
+void StreamingFilter::Initialize()
+{
+    if (channel_number_ == 0)
+        throw std::invalid_argument("The channel number must be positive.");
+
+    if (structure_ == FilterStructure::second_order_sections)
+    {
+        NormalizeSos(sos_coefficients_);
+        SosInitialState(sos_coefficients_, steady_state_);
+    }
+    else
+    {
+        if (coefficients_a_.empty() || coefficients_a_.front() == 0)
+            throw std::domain_error(
+                "First feedback coefficient has to be non-zero.");
+        if (coefficients_b_.empty())
+            throw std::domain_error(
+                "The feedforward filter coefficients are empty.");
+
+        // 归一化并补齐到相同长度
+        auto n = std::max(coefficients_a_.size(), coefficients_b_.size());
+        coefficients_a_.resize(n, 0.0);
+        coefficients_b_.resize(n, 0.0);
+        double a0 = coefficients_a_.front();
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            coefficients_a_[k] /= a0;
+            coefficients_b_[k] /= a0;
+        }
+
+        // 单位阶跃输入下直接II型转置结构的稳态状态，输出为直流增益
+        double sum_a = 0.0, sum_b = 0.0;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            sum_a += coefficients_a_[k];
+            sum_b += coefficients_b_[k];
+        }
+        double gain = sum_b / sum_a;
+        steady_state_.assign(n - 1, 0.0);
+        for (std::size_t k = n - 1; k > 0; --k)
+        {
+            steady_state_[k - 1] =
+                coefficients_b_[k] - coefficients_a_[k] * gain
+                + (k < n - 1 ? steady_state_[k] : 0.0);
+        }
+    }
+    state_.assign(steady_state_.size() * channel_number_, 0.0);
+}
+
+} // namespace numerical_algorithm
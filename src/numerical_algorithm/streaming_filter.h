@@ -0,0 +1,128 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\streaming_filter.h
+** -----
+** File Created: Friday, 16th October 2026 15:42:18
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 15:42:18
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：流式滤波方法类
+// 逐块输入信号，块与块之间保留滤波器状态，分块滤波的结果与整段信号一次滤波
+// 的结果逐位相同；多通道信号按通道交错存储（见multichannel_filter.h）
+
+#ifndef NUMERICAL_ALGORITHM_STREAMING_FILTER_H_
+#define NUMERICAL_ALGORITHM_STREAMING_FILTER_H_
+
+// stdc++ headers
+#include <cstddef>
+#include <vector>
+
+// project headers
+#include "basic_filtering.h"
+#include "butterworth_filter_design.h"
+#include "sos_filter.h"
+
+
+namespace numerical_algorithm
+{
+
+// 流式滤波方法类
+class StreamingFilter
+{
+public:
+    // 默认构造函数
+    StreamingFilter() = default;
+
+    // 由两个std::vector参数构造，初始状态为零
+    // @param coefficients_a 滤波器分母系数
+    // @param coefficients_b 滤波器分子系数
+    // @param channel_number 通道数
+    StreamingFilter(std::vector<double> coefficients_a,
+                    std::vector<double> coefficients_b,
+                    std::size_t channel_number = 1);
+
+    // 由二阶节系数构造，初始状态为零
+    // @param sos_coefficients 二阶节系数
+    // @param channel_number 通道数
+    explicit StreamingFilter(SosCoefficients sos_coefficients,
+                             std::size_t channel_number = 1);
+
+    // 由butterworth滤波器设计构造，初始状态为零
+    // @param filter_design butterworth滤波器设计类
+    // @param structure 滤波器结构
+    // @param channel_number 通道数
+    StreamingFilter(
+        const ButterworthFilterDesign &filter_design,
+        FilterStructure structure = FilterStructure::transfer_function,
+        std::size_t channel_number = 1);
+
+    // 析构函数
+    ~StreamingFilter() = default;
+
+    // 滤波一块信号，滤波器状态保留到下一次调用
+    // @param input 交错存储的输入信号，共sample_number * channel_number个值
+    // @param output 交错存储的输出信号，可以与输入相同
+    // @param sample_number 每个通道的样本数
+    void
+    Process(const double *input, double *output, std::size_t sample_number);
+
+    // 滤波一块信号，滤波器状态保留到下一次调用
+    // @param input 交错存储的输入信号，长度为通道数的整数倍
+    // @param output 交错存储的输出信号，尺寸自动调整为输入长度（尺寸不变时
+    //        不重新分配内存）
+    void Process(const std::vector<double> &input, std::vector<double> &output);
+
+    // 将滤波器状态清零
+    void Reset();
+
+    // 将滤波器状态设为各通道输入恒为给定值时的稳态，避免启动时的瞬态
+    // @param value 各通道的输入值，长度为通道数
+    void ResetSteadyState(const std::vector<double> &value);
+
+    // 获取滤波器结构
+    // @return 滤波器结构
+    FilterStructure get_filter_structure() const { return structure_; }
+
+    // 获取通道数
+    // @return 通道数
+    std::size_t get_channel_number() const { return channel_number_; }
+
+    // 获取滤波器状态
+    // @return 滤波器状态，第k个状态的第c个通道位于[k * 通道数 + c]
+    const std::vector<double> &get_state() const { return state_; }
+
+    // 设置滤波器状态，用于恢复之前保存的状态
+    // @param state 滤波器状态，长度与get_state()相同
+    void set_state(const std::vector<double> &state);
+
+private:
+    // 滤波器结构
+    FilterStructure structure_{FilterStructure::transfer_function};
+    // 归一化并补齐到相同长度的传递函数系数
+    std::vector<double> coefficients_a_, coefficients_b_;
+    // 二阶节系数
+    SosCoefficients sos_coefficients_{};
+    // 通道数
+    std::size_t channel_number_{1};
+    // 各通道的滤波器状态
+    std::vector<double> state_{};
+    // 单位阶跃输入下的稳态状态（单通道）
+    std::vector<double> steady_state_{};
+
+    // 归一化系数，计算稳态状态并分配状态存储
+    void Initialize();
+};
+
+} // namespace numerical_algorithm
+
+#endif // NUMERICAL_ALGORITHM_STREAMING_FILTER_H_
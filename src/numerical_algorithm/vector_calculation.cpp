@@ -0,0 +1,275 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\vector_calculation.cpp
+** -----
+** File Created: Friday, 16th October 2026 17:32:05
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Friday, 16th October 2026 17:32:05
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：向量计算中互相关和卷积的实现
+
+// associated header
+#include "vector_calculation.h"
+
+// stdc++ headers
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+// third-party headers
+#include "fftw3.h"
+
+// project headers
+#include "fft_plan_cache.h"
+#include "frequency_filtering.h"
+
+
+namespace numerical_algorithm
+{
+
+namespace
+{
+
+// 较短序列的长度不超过阈值时使用直接计算
+// @param size_x 向量x的长度
+// @param size_y 向量y的长度
+// @return 是否使用直接计算
+bool UseDirect(std::size_t size_x, std::size_t size_y)
+{
+    return std::min(size_x, size_y) <= kDirectConvolutionLength;
+}
+
+// 基于FFT的卷积和互相关，保存参考向量的频谱以便与多个向量计算
+class SpectralProduct
+{
+public:
+    // @param vector_x 参考向量x
+    // @param correlation true计算互相关，false计算卷积
+    SpectralProduct(const std::vector<double> &vector_x, bool correlation)
+        : vector_x_(vector_x), correlation_(correlation)
+    {}
+
+    // 计算向量y与参考向量x的卷积或互相关
+    // @param vector_y 向量y
+    // @param result 计算结果，尺寸自动调整
+    void Compute(const std::vector<double> &vector_y,
+                 std::vector<double> &result)
+    {
+        if (vector_x_.empty() || vector_y.empty())
+        {
+            result.clear();
+            return;
+        }
+
+        // 1.补零到不小于线性卷积长度的FFT长度，避免循环卷积的混叠；
+        // 长度变化时重新计算参考向量的频谱
+        auto size = vector_x_.size() + vector_y.size() - 1;
+        auto fft_size = FrequencyFiltering::FastLength(size);
+        if (fft_size != fft_size_)
+        {
+            // 计划以FFTW_UNALIGNED创建，执行时不需要加锁
+            fft_size_ = fft_size;
+            auto &cache = FftPlanCache::Global();
+            forward_plan_ = cache.Get(fft_size_, FftDirection::forward, false);
+            backward_plan_ =
+                cache.Get(fft_size_, FftDirection::backward, false);
+            Forward(vector_x_, spectrum_x_);
+        }
+
+        // 2.频谱相乘，互相关取y的共轭，逆FFT的归一化系数合并到乘积中
+        Forward(vector_y, spectrum_y_);
+        double scale = 1.0 / fft_size_;
+        for (std::size_t k = 0; k < spectrum_y_.size(); ++k)
+        {
+            auto y = correlation_ ? std::conj(spectrum_y_[k]) : spectrum_y_[k];
+            spectrum_y_[k] = spectrum_x_[k] * y * scale;
+        }
+        fftw_execute_dft_c2r(
+            backward_plan_,
+            reinterpret_cast<fftw_complex *>(spectrum_y_.data()),
+            signal_.data());
+
+        // 3.截取结果，循环互相关的负移位部分位于序列末尾
+        result.resize(size);
+        if (correlation_)
+        {
+            auto lag = vector_y.size() - 1;
+            std::copy(
+                signal_.end() - lag, signal_.end(), result.begin());
+            std::copy(signal_.begin(),
+                      signal_.begin() + (size - lag),
+                      result.begin() + lag);
+        }
+        else
+        {
+            std::copy(signal_.begin(), signal_.begin() + size, result.begin());
+        }
+    }
+
+private:
+    // 参考向量
+    const std::vector<double> &vector_x_;
+    // 是否计算互相关
+    bool correlation_;
+    // 当前的FFT长度和计划，计划由全局计划缓存持有
+    std::size_t fft_size_{0};
+    fftw_plan forward_plan_{nullptr}, backward_plan_{nullptr};
+    // 补零后的信号
+    std::vector<double> signal_{};
+    // 参考向量和当前向量的频谱
+    std::vector<std::complex<double>> spectrum_x_{}, spectrum_y_{};
+
+    // 补零到FFT长度并做正向FFT
+    void Forward(const std::vector<double> &input,
+                 std::vector<std::complex<double>> &spectrum)
+    {
+        signal_.assign(fft_size_, 0.0);
+        std::copy(input.begin(), input.end(), signal_.begin());
+        spectrum.resize(fft_size_ / 2 + 1);
+        fftw_execute_dft_r2c(forward_plan_,
+                             signal_.data(),
+                             reinterpret_cast<fftw_complex *>(spectrum.data()));
+    }
+};
+
+// 一个参考向量与多个向量的卷积或互相关，逐个按长度选择计算方式
+// @param vector_x 参考向量x
+// @param vectors_y 向量y的集合
+// @param correlation true计算互相关，false计算卷积
+// @return 各向量y与x的计算结果
+std::vector<std::vector<double>>
+BatchProduct(const std::vector<double> &vector_x,
+             const std::vector<std::vector<double>> &vectors_y,
+             bool correlation)
+{
+    std::vector<std::vector<double>> result(vectors_y.size());
+    SpectralProduct product(vector_x, correlation);
+    for (std::size_t i = 0; i < vectors_y.size(); ++i)
+    {
+        if (!UseDirect(vector_x.size(), vectors_y[i].size()))
+        {
+            product.Compute(vectors_y[i], result[i]);
+        }
+        else if (correlation)
+        {
+            result[i] = CrossCorrelationDirect(vector_x, vectors_y[i]);
+        }
+        else
+        {
+            result[i] = ConvolutionDirect(vector_x, vectors_y[i]);
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+// 向量互相关序列，直接计算
+std::vector<double> CrossCorrelationDirect(const std::vector<double> &vector_x,
+                                           const std::vector<double> &vector_y)
+{
+    if (vector_x.empty() || vector_y.empty())
+    {
+        return {};
+    }
+    int n_a = vector_x.size();
+    int n_b = vector_y.size();
+    std::vector<double> result(n_a + n_b - 1);
+    for (int shift = -(n_b - 1); shift <= n_a - 1; ++shift)
+    {
+        result[shift + (n_b - 1)] =
+            CrossCorrelationAtShift(vector_x, vector_y, shift);
+    }
+    return result;
+}
+
+// 向量互相关序列，基于FFT计算
+std::vector<double> CrossCorrelationFft(const std::vector<double> &vector_x,
+                                        const std::vector<double> &vector_y)
+{
+    std::vector<double> result;
+    SpectralProduct(vector_x, true).Compute(vector_y, result);
+    return result;
+}
+
+// 向量互相关序列，按长度自动选择直接计算或FFT
+std::vector<double> CrossCorrelation(const std::vector<double> &vector_x,
+                                     const std::vector<double> &vector_y)
+{
+    return UseDirect(vector_x.size(), vector_y.size())
+               ? CrossCorrelationDirect(vector_x, vector_y)
+               : CrossCorrelationFft(vector_x, vector_y);
+}
+
+// 一个参考向量与多个向量的互相关序列
+std::vector<std::vector<double>>
+CrossCorrelation(const std::vector<double> &vector_x,
+                 const std::vector<std::vector<double>> &vectors_y)
+{
+    return BatchProduct(vector_x, vectors_y, true);
+}
+
+// 向量卷积序列，直接计算
+std::vector<double> ConvolutionDirect(const std::vector<double> &vector_x,
+                                      const std::vector<double> &vector_y)
+{
+    if (vector_x.empty() || vector_y.empty())
+    {
+        return {};
+    }
+    auto n_a = vector_x.size();
+    auto n_b = vector_y.size();
+    std::vector<double> result(n_a + n_b - 1);
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        // 只遍历x[i - j]和y[j]都有定义的j，内层循环不含分支
+        auto j_begin = i + 1 > n_a ? i + 1 - n_a : 0;
+        auto j_end = std::min(i + 1, n_b);
+        double sum = 0.0;
+        for (auto j = j_begin; j < j_end; ++j)
+        {
+            sum += vector_x[i - j] * vector_y[j];
+        }
+        result[i] = sum;
+    }
+    return result;
+}
+
+// 向量卷积序列，基于FFT计算
+std::vector<double> ConvolutionFft(const std::vector<double> &vector_x,
+                                   const std::vector<double> &vector_y)
+{
+    std::vector<double> result;
+    SpectralProduct(vector_x, false).Compute(vector_y, result);
+    return result;
+}
+
+// 向量卷积序列，按长度自动选择直接计算或FFT
+std::vector<double> Convolution(const std::vector<double> &vector_x,
+                                const std::vector<double> &vector_y)
+{
+    return UseDirect(vector_x.size(), vector_y.size())
+               ? ConvolutionDirect(vector_x, vector_y)
+               : ConvolutionFft(vector_x, vector_y);
+}
+
+// 一个参考向量与多个向量的卷积序列
+std::vector<std::vector<double>>
+Convolution(const std::vector<double> &vector_x,
+            const std::vector<std::vector<double>> &vectors_y)
+{
+    return BatchProduct(vector_x, vectors_y, false);
+}
+
+} // namespace numerical_algorithm
@@ -24,10 +24,14 @@
 // stdc++ headers
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <cstdlib>
 #include <stdexcept>
 #include <vector>
 
+// project headers
+#include "vector_expression.h"
+
 
 namespace numerical_algorithm
 {
@@ -48,48 +52,30 @@ inline std::vector<std::size_t> FindPeaks(const std::vector<double> &vec)
     return peaks;
 }
 
-// 向量计算
+// 向量计算，运算符只在调用时判断一次，逐元素计算为融合的单个循环；
+// 组合多个运算时应直接使用vector_expression.h中的表达式，避免中间向量
 // @param vector1 向量1
-// @param vector2 向量2
+// @param vector2 向量2，长度须与向量1相同
 // @param operation 操作符
 // @return 计算结果
 inline std::vector<double> VectorOperation(const std::vector<double> &vector1,
                                            const std::vector<double> &vector2,
                                            const char operation)
 {
-    auto vec_size = vector1.size();
-    std::vector<double> result(vec_size);
+    auto x = MakeVector(vector1), y = MakeVector(vector2);
     switch (operation)
     {
         case '+':
-            for (std::size_t i = 0; i < vec_size; ++i)
-            {
-                result[i] = vector1[i] + vector2[i];
-            }
-            break;
+            return (x + y).Evaluate();
         case '-':
-            for (std::size_t i = 0; i < vec_size; ++i)
-            {
-                result[i] = vector1[i] - vector2[i];
-            }
-            break;
+            return (x - y).Evaluate();
         case '*':
-            for (std::size_t i = 0; i < vec_size; ++i)
-            {
-                result[i] = vector1[i] * vector2[i];
-            }
-            break;
+            return (x * y).Evaluate();
         case '/':
-            for (std::size_t i = 0; i < vec_size; ++i)
-            {
-                result[i] = vector1[i] / vector2[i];
-            }
-            break;
+            return (x / y).Evaluate();
         default:
             throw std::invalid_argument("Invalid operation");
-            break;
     }
-    return result;
 }
 
 // 向量计算
@@ -101,39 +87,20 @@ inline std::vector<double> VectorOperation(const std::vector<double> &vector1,
                                            const double scalar,
                                            const char operation)
 {
-    auto vec_size = vector1.size();
-    std::vector<double> result(vec_size);
+    auto x = MakeVector(vector1);
     switch (operation)
     {
         case '+':
-            for (std::size_t i = 0; i < vec_size; ++i)
-            {
-                result[i] = vector1[i] + scalar;
-            }
-            break;
+            return (x + scalar).Evaluate();
         case '-':
-            for (std::size_t i = 0; i < vec_size; ++i)
-            {
-                result[i] = vector1[i] - scalar;
-            }
-            break;
+            return (x - scalar).Evaluate();
         case '*':
-            for (std::size_t i = 0; i < vec_size; ++i)
-            {
-                result[i] = vector1[i] * scalar;
-            }
-            break;
+            return (x * scalar).Evaluate();
         case '/':
-            for (std::size_t i = 0; i < vec_size; ++i)
-            {
-                result[i] = vector1[i] / scalar;
-            }
-            break;
+            return (x / scalar).Evaluate();
         default:
             throw std::invalid_argument("Invalid operation");
-            break;
     }
-    return result;
 }
 
 // 寻找向量绝对值最大的元素
@@ -153,7 +120,7 @@ inline double FindMaxAbs(const std::vector<double> &input_vector)
 inline std::vector<double> Normalize(const std::vector<double> &input_vector)
 {
     auto max_abs = FindMaxAbs(input_vector);
-    return VectorOperation(input_vector, max_abs, '/');
+    return (MakeVector(input_vector) / max_abs).Evaluate();
 }
 
 // 计算给定移位参数的互相关值
@@ -166,14 +133,12 @@ inline double CrossCorrelationAtShift(const std::vector<double> &vector_x,
 {
     int n_a = vector_x.size();
     int n_b = vector_y.size();
+    // 只遍历重叠区间，内层循环不含分支
+    int begin = std::max(0, shift), end = std::min(n_a, n_b + shift);
     double result = 0.0;
-    for (int i = 0; i < n_a; ++i)
+    for (int i = begin; i < end; ++i)
     {
-        int j = i - shift;
-        if (j >= 0 && j < n_b)
-        {
-            result += vector_x[i] * vector_y[j];
-        }
+        result += vector_x[i] * vector_y[i - shift];
     }
     return result;
 }
@@ -192,25 +157,37 @@ CrossCorrelationAtShiftNormalized(const std::vector<double> &vector_x,
                        * CrossCorrelationAtShift(vector_y, vector_y, 0));
 }
 
-// 向量互相关序列
+// 较短序列不超过该长度时，卷积和互相关使用直接计算，否则使用FFT
+constexpr std::size_t kDirectConvolutionLength = 64;
+
+// 向量互相关序列，直接计算，复杂度O(N*M)
 // @param vector_x 向量x
 // @param vector_y 向量y
-// @return 互相关序列
-inline std::vector<double> CrossCorrelation(const std::vector<double> &vector_x,
-                                            const std::vector<double> &vector_y)
-{
-    int n_a = vector_x.size();
-    int n_b = vector_y.size();
-    int n = n_a + n_b - 1;
-    std::vector<double> result(n, 0.0);
+// @return 互相关序列，第k个值对应移位参数k - (y的长度 - 1)
+std::vector<double> CrossCorrelationDirect(const std::vector<double> &vector_x,
+                                           const std::vector<double> &vector_y);
 
-    for (int shift = -(n_b - 1); shift <= n_a - 1; ++shift)
-    {
-        result[shift + (n_b - 1)] =
-            CrossCorrelationAtShift(vector_x, vector_x, shift);
-    }
-    return result;
-}
+// 向量互相关序列，基于FFT计算，复杂度O((N+M)log(N+M))
+// @param vector_x 向量x
+// @param vector_y 向量y
+// @return 互相关序列，第k个值对应移位参数k - (y的长度 - 1)
+std::vector<double> CrossCorrelationFft(const std::vector<double> &vector_x,
+                                        const std::vector<double> &vector_y);
+
+// 向量互相关序列，按长度自动选择直接计算或FFT
+// @param vector_x 向量x
+// @param vector_y 向量y
+// @return 互相关序列，第k个值对应移位参数k - (y的长度 - 1)
+std::vector<double> CrossCorrelation(const std::vector<double> &vector_x,
+                                     const std::vector<double> &vector_y);
+
+// 一个参考向量与多个向量的互相关序列，参考向量的频谱只计算一次
+// @param vector_x 参考向量x
+// @param vectors_y 向量y的集合
+// @return 各向量y与x的互相关序列
+std::vector<std::vector<double>>
+CrossCorrelation(const std::vector<double> &vector_x,
+                 const std::vector<std::vector<double>> &vectors_y);
 
 // 向量互相关序列，并作归一化处理
 // @param vector_x 向量x
@@ -223,7 +200,27 @@ CrossCorrelationNormalized(const std::vector<double> &vector_x,
     auto result = CrossCorrelation(vector_x, vector_y);
     double norm = std::sqrt(CrossCorrelationAtShift(vector_x, vector_x, 0)
                             * CrossCorrelationAtShift(vector_y, vector_y, 0));
-    return VectorOperation(result, norm, '/');
+    (MakeVector(result) / norm).EvaluateTo(result);
+    return result;
+}
+
+// 一个参考向量与多个向量的互相关序列，并作归一化处理
+// @param vector_x 参考向量x
+// @param vectors_y 向量y的集合
+// @return 各向量y与x归一化后的互相关序列
+inline std::vector<std::vector<double>>
+CrossCorrelationNormalized(const std::vector<double> &vector_x,
+                           const std::vector<std::vector<double>> &vectors_y)
+{
+    auto result = CrossCorrelation(vector_x, vectors_y);
+    double energy_x = CrossCorrelationAtShift(vector_x, vector_x, 0);
+    for (std::size_t i = 0; i < result.size(); ++i)
+    {
+        double norm = std::sqrt(
+            energy_x * CrossCorrelationAtShift(vectors_y[i], vectors_y[i], 0));
+        (MakeVector(result[i]) / norm).EvaluateTo(result[i]);
+    }
+    return result;
 }
 
 // 向量自相关序列
@@ -234,30 +231,34 @@ inline std::vector<double> AutoCorrelation(const std::vector<double> &vector_x)
     return CrossCorrelation(vector_x, vector_x);
 }
 
-// 向量卷积序列
+// 向量卷积序列，直接计算，复杂度O(N*M)
 // @param vector_x 向量x
 // @param vector_y 向量y
 // @return 卷积序列
-inline std::vector<double> Convolution(const std::vector<double> &vector_x,
-                                       const std::vector<double> &vector_y)
-{
-    int n_a = vector_x.size();
-    int n_b = vector_y.size();
-    int n = n_a + n_b - 1;
-    std::vector<double> result(n, 0.0);
+std::vector<double> ConvolutionDirect(const std::vector<double> &vector_x,
+                                      const std::vector<double> &vector_y);
 
-    for (int i = 0; i < n; ++i)
-    {
-        for (int j = 0; j < n_b; ++j)
-        {
-            if ((i - j) >= 0 && (i - j) < n_a)
-            {
-                result[i] += vector_x[i - j] * vector_y[j];
-            }
-        }
-    }
-    return result;
-}
+// 向量卷积序列，基于FFT计算，复杂度O((N+M)log(N+M))
+// @param vector_x 向量x
+// @param vector_y 向量y
+// @return 卷积序列
+std::vector<double> ConvolutionFft(const std::vector<double> &vector_x,
+                                   const std::vector<double> &vector_y);
+
+// 向量卷积序列，按长度自动选择直接计算或FFT
+// @param vector_x 向量x
+// @param vector_y 向量y
+// @return 卷积序列
+std::vector<double> Convolution(const std::vector<double> &vector_x,
+                                const std::vector<double> &vector_y);
+
+// 一个参考向量与多个向量的卷积序列，参考向量的频谱只计算一次
+// @param vector_x 参考向量x
+// @param vectors_y 向量y的集合
+// @return 各向量y与x的卷积序列
+std::vector<std::vector<double>>
+Convolution(const std::vector<double> &vector_x,
+            const std::vector<std::vector<double>> &vectors_y);
 
 } // namespace numerical_algorithm
 
@@ -0,0 +1,300 @@
+﻿/**
+**            qREST - Quick Response Evaluation for Safety Tagging
+**     Institute of Engineering Mechanics, China Earthquake Administration
+**
+**                 Copyright 2024 - 2024 QLab, Dong Feiyue
+**                          All Rights Reserved.
+**
+** Project: qREST
+** File: \src\numerical_algorithm\vector_expression.h
+** -----
+** File Created: Saturday, 17th October 2026 19:10:42
+** Author: Dong Feiyue (donfeiyue@outlook.com)
+** -----
+** Last Modified: Saturday, 17th October 2026 19:10:42
+** Modified By: Dong Feiyue (donfeiyue@outlook.com)
+*/
+
+// Description:
+// 数值算法：逐元素的惰性向量表达式（表达式模板）
+// 四则运算只记录操作数和运算类型，不分配中间向量；求值时整个表达式展开为一个
+// 循环，每个元素只计算一次、只写一次，编译器可对该循环自动向量化。例如：
+//   auto x = MakeVector(vector_x), y = MakeVector(vector_y);
+//   ((x - y) * 0.5 / scale).EvaluateTo(result);
+// 操作数可以是std::vector<double>、std::vector<float>或任何提供data()和size()
+// 的连续存储（如data_structure::ColumnView）。表达式引用操作数，操作数须在求值
+// 之前保持有效；结果可以写回操作数本身（逐元素原位计算）。
+
+#ifndef NUMERICAL_ALGORITHM_VECTOR_EXPRESSION_H_
+#define NUMERICAL_ALGORITHM_VECTOR_EXPRESSION_H_
+
+// stdc++ headers
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+
+namespace numerical_algorithm
+{
+
+// 向量表达式的基类，Derived须提供size()和operator[](i)，operator[](i)返回第i个
+// 元素的值（double）
+template <typename Derived> class VectorExpression
+{
+public:
+    const Derived &derived() const
+    {
+        return static_cast<const Derived &>(*this);
+    }
+
+    // 获取长度
+    std::size_t size() const { return derived().size(); }
+
+    // 获取第i个元素的值
+    double operator[](std::size_t index) const { return derived()[index]; }
+
+    // 求值并写入调用者提供的缓冲区
+    // @param result 结果缓冲区，长度不小于size()
+    void EvaluateTo(double *result) const
+    {
+        const Derived &expression = derived();
+        const std::size_t n = expression.size();
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            result[i] = expression[i];
+        }
+    }
+
+    // 求值并写入结果向量，长度自动调整（长度不变时不重新分配内存）
+    // @param result 结果向量，可以是表达式的操作数
+    void EvaluateTo(std::vector<double> &result) const
+    {
+        result.resize(size());
+        EvaluateTo(result.data());
+    }
+
+    // 求值为新的向量
+    // @return 计算结果
+    std::vector<double> Evaluate() const
+    {
+        std::vector<double> result(size());
+        EvaluateTo(result.data());
+        return result;
+    }
+};
+
+// 引用连续存储的向量表达式，不持有数据
+// @tparam T 元素类型（double、float）
+template <typename T>
+class VectorReference : public VectorExpression<VectorReference<T>>
+{
+public:
+    // 由数据指针和长度构造
+    // @param data 数据指针
+    // @param size 数据长度
+    VectorReference(const T *data, std::size_t size) : data_(data), size_(size)
+    {}
+
+    std::size_t size() const { return size_; }
+    double operator[](std::size_t index) const
+    {
+        return static_cast<double>(data_[index]);
+    }
+
+private:
+    const T *data_{nullptr};
+    std::size_t size_{0};
+};
+
+// 逐元素一元运算的向量表达式
+// @tparam E 操作数表达式类型
+// @tparam Operation 一元运算函数对象类型
+template <typename E, typename Operation>
+class UnaryVectorExpression
+    : public VectorExpression<UnaryVectorExpression<E, Operation>>
+{
+public:
+    explicit UnaryVectorExpression(const E &operand,
+                                   Operation operation = Operation())
+        : operand_(operand), operation_(operation)
+    {}
+
+    std::size_t size() const { return operand_.size(); }
+    double operator[](std::size_t index) const
+    {
+        return operation_(operand_[index]);
+    }
+
+private:
+    E operand_;
+    Operation operation_;
+};
+
+// 逐元素二元运算的向量表达式，两个操作数长度须相同
+// @tparam L 左操作数表达式类型
+// @tparam R 右操作数表达式类型
+// @tparam Operation 二元运算函数对象类型（std::plus<double>等）
+template <typename L, typename R, typename Operation>
+class BinaryVectorExpression
+    : public VectorExpression<BinaryVectorExpression<L, R, Operation>>
+{
+public:
+    BinaryVectorExpression(const L &left, const R &right)
+        : left_(left), right_(right)
+    {
+        if (left_.size() != right_.size())
+            throw std::invalid_argument(
+                "The operand sizes of a vector expression do not match.");
+    }
+
+    std::size_t size() const { return left_.size(); }
+    double operator[](std::size_t index) const
+    {
+        return Operation()(left_[index], right_[index]);
+    }
+
+private:
+    L left_;
+    R right_;
+};
+
+// 向量与标量逐元素运算的向量表达式
+// @tparam E 向量操作数表达式类型
+// @tparam Operation 二元运算函数对象类型（std::plus<double>等）
+// @tparam ScalarLeft 标量是否为左操作数
+template <typename E, typename Operation, bool ScalarLeft = false>
+class ScalarVectorExpression
+    : public VectorExpression<ScalarVectorExpression<E, Operation, ScalarLeft>>
+{
+public:
+    ScalarVectorExpression(const E &operand, double scalar)
+        : operand_(operand), scalar_(scalar)
+    {}
+
+    std::size_t size() const { return operand_.size(); }
+    double operator[](std::size_t index) const
+    {
+        return ScalarLeft ? Operation()(scalar_, operand_[index])
+                          : Operation()(operand_[index], scalar_);
+    }
+
+private:
+    E operand_;
+    double scalar_;
+};
+
+// 取绝对值的函数对象
+struct AbsOperation
+{
+    double operator()(double value) const { return std::abs(value); }
+};
+
+// 由连续存储构造向量表达式
+// @param container std::vector或提供data()和size()的连续存储
+// @return 引用该存储的向量表达式
+template <typename Container>
+auto MakeVector(const Container &container)
+    -> VectorReference<std::remove_const_t<
+        std::remove_pointer_t<decltype(container.data())>>>
+{
+    return {container.data(), container.size()};
+}
+
+// 由数据指针和长度构造向量表达式
+// @param data 数据指针
+// @param size 数据长度
+// @return 引用该数据的向量表达式
+template <typename T>
+VectorReference<T> MakeVector(const T *data, std::size_t size)
+{
+    return {data, size};
+}
+
+// 向量与向量的四则运算
+#define NUMERICAL_ALGORITHM_VECTOR_OPERATOR(OP, FUNCTION)                      \
+    template <typename L, typename R>                                          \
+    BinaryVectorExpression<L, R, FUNCTION<double>> operator OP(                \
+        const VectorExpression<L> &left, const VectorExpression<R> &right)     \
+    {                                                                          \
+        return {left.derived(), right.derived()};                              \
+    }                                                                          \
+    template <typename E>                                                      \
+    ScalarVectorExpression<E, FUNCTION<double>> operator OP(                   \
+        const VectorExpression<E> &left, double right)                         \
+    {                                                                          \
+        return {left.derived(), right};                                        \
+    }                                                                          \
+    template <typename E>                                                      \
+    ScalarVectorExpression<E, FUNCTION<double>, true> operator OP(             \
+        double left, const VectorExpression<E> &right)                         \
+    {                                                                          \
+        return {right.derived(), left};                                        \
+    }
+
+NUMERICAL_ALGORITHM_VECTOR_OPERATOR(+, std::plus)
+NUMERICAL_ALGORITHM_VECTOR_OPERATOR(-, std::minus)
+NUMERICAL_ALGORITHM_VECTOR_OPERATOR(*, std::multiplies)
+NUMERICAL_ALGORITHM_VECTOR_OPERATOR(/, std::divides)
+
+#undef NUMERICAL_ALGORITHM_VECTOR_OPERATOR
+
+// 取负
+template <typename E>
+UnaryVectorExpression<E, std::negate<double>>
+operator-(const VectorExpression<E> &operand)
+{
+    return UnaryVectorExpression<E, std::negate<double>>(operand.derived());
+}
+
+// 逐元素取绝对值
+template <typename E>
+UnaryVectorExpression<E, AbsOperation> Abs(const VectorExpression<E> &operand)
+{
+    return UnaryVectorExpression<E, AbsOperation>(operand.derived());
+}
+
+// 表达式各元素之和，按下标顺序累加
+// @param expression 向量表达式
+// @return 元素之和
+template <typename E> double Sum(const VectorExpression<E> &expression)
+{
+    const E &derived = expression.derived();
+    double result = 0.0;
+    for (std::size_t i = 0; i < derived.size(); ++i)
+    {
+        result += derived[i];
+    }
+    return result;
+}
+
+// 两个表达式的内积，不生成逐元素乘积的中间向量
+// @param left 向量表达式
+// @param right 向量表达式
+// @return 内积
+template <typename L, typename R>
+double Dot(const VectorExpression<L> &left, const VectorExpression<R> &right)
+{
+    return Sum(left * right);
+}
+
+// 表达式各元素绝对值的最大值，空表达式返回0
+// @param expression 向量表达式
+// @return 绝对值的最大值
+template <typename E> double MaxAbs(const VectorExpression<E> &expression)
+{
+    const E &derived = expression.derived();
+    double result = 0.0;
+    for (std::size_t i = 0; i < derived.size(); ++i)
+    {
+        result = std::max(result, std::abs(derived[i]));
+    }
+    return result;
+}
+
+} // namespace numerical_algorithm
+
+#endif // NUMERICAL_ALGORITHM_VECTOR_EXPRESSION_H_
@@ -57,7 +57,7 @@ void ChartData::CalculateGmp(std::size_t idx)
     // 计算对象赋值
     cur_idx_ = idx;
     gmp_ = gmp_calculation::GmpCalculation(
-        data_interface_->acc_[cur_dir_].col(cur_idx_));
+        data_interface_->acc_[cur_dir_].get_col(cur_idx_));
 }
 
 // FilteringIntegral计算EDP
@@ -110,7 +110,7 @@ ChartData::points_vector ChartData::get_acceleration(std::size_t idx)
     }
 
     // 获取加速度数据
-    const auto &acc = data_interface_->acc_[cur_dir_].col(idx);
+    const auto acc = data_interface_->acc_[cur_dir_].get_col(idx);
     return {time_, acc};
 }
 
@@ -379,11 +379,7 @@ void ChartData::get_time_()
 // 生成反应谱横轴的函数
 void ChartData::get_period_()
 {
-    period_.resize(gmp_.AccelerationSpectrum().size());
-    for (std::size_t i = 0; i != period_.size(); ++i)
-    {
-        period_[i] = i * gmp_.get_parameter().response_spectrum_dt_;
-    }
+    period_ = gmp_.get_response_spectrum().periods;
 }
 
 // 生成Fourier谱横轴的函数
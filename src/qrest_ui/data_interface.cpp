@@ -24,12 +24,16 @@
 // stdc++ library
 #include <cstddef>
 #include <fstream>
-#include <sstream>
+#include <utility>
 #include <vector>
 
 // third-party library
 #include "nlohmann/json.hpp"
 
+// project headers
+#include "data_structure/binary_record.h"
+#include "data_structure/text_matrix_reader.h"
+
 // 读取文件的构造函数
 DataInterface::DataInterface(const std::string &file_path)
 {
@@ -47,30 +51,44 @@ DataInterface::DataInterface(const std::string &port, const int &baudrate)
 // 读取文件
 void DataInterface::ReadFile(const std::string &file_path)
 {
-    std::ifstream file(file_path);
-    if (!file.is_open())
-    {
-        throw std::runtime_error("File not found");
-    }
+    // 以内存映射方式读取并多线程解析，每行为一个时刻，各列依次为各方向各测点
+    auto matrix = data_structure::ReadTextMatrix(
+        file_path, config_.direction_ * config_.mea_number_, 0);
 
+    // 将数据转换为加速度数据，各方向通过视图选择各自的列，不复制数据
+    all_acc_ = data_structure::Acceleration(
+        std::move(matrix), config_.frequency_, config_.scale_);
+    SplitDirections();
+}
 
-    // 读取数据
-    std::vector<std::vector<double>> ori_acc;
-    ori_acc.resize(config_.direction_ * config_.mea_number_);
-    std::string line;
-    while (std::getline(file, line))
-    {
-        std::istringstream iss(line);
-        double value;
-        for (size_t i = 0; i < config_.direction_ * config_.mea_number_; i++)
-        {
-            iss >> value;
-            ori_acc.at(i).push_back(value);
-        }
-    }
+// 读取二进制记录
+void DataInterface::ReadBinaryFile(const std::string &file_path)
+{
+    auto record = data_structure::ReadBinaryRecord(file_path);
+    config_.direction_ = record.info_.direction_;
+    config_.mea_number_ = record.info_.mea_number_;
+    config_.time_count_ = record.acceleration_.get_row_number();
+    config_.frequency_ = record.acceleration_.get_frequency();
+    config_.scale_ = record.info_.scale_;
+    all_acc_ = std::move(record.acceleration_);
+    building_ = std::move(record.building_);
+    SplitDirections();
+}
 
-    // 将数据转换为加速度数据
-    // acceleration_data_.resize(direction);
+// 写入二进制记录
+void DataInterface::WriteBinaryFile(const std::string &file_path) const
+{
+    data_structure::BinaryRecordInfo info;
+    info.direction_ = config_.direction_;
+    info.mea_number_ = config_.mea_number_;
+    info.scale_ = config_.scale_;
+    data_structure::WriteBinaryRecord(file_path, all_acc_, building_, info);
+}
+
+// 按配置的方向布局创建各方向的视图
+void DataInterface::SplitDirections()
+{
+    acc_.clear();
     for (size_t i = 0; i < config_.direction_; i++)
     {
         // 从指定列构造，这里每1/3列构造一个方向的数据
@@ -79,7 +97,7 @@ void DataInterface::ReadFile(const std::string &file_path)
         {
             col_idx.push_back(j + config_.direction_ * i);
         }
-        acc_.emplace_back(ori_acc, col_idx, config_.frequency_, config_.scale_);
+        acc_.emplace_back(all_acc_, col_idx);
     }
 }
 
@@ -94,7 +112,7 @@ void DataInterface::ReadSerialPort(const std::string &port, const int &baudrate)
 data_structure::Acceleration
 DataInterface::GetAccelerationData(std::size_t index) const
 {
-    return acc_.at(index);
+    return data_structure::Acceleration(acc_.at(index));
 }
 
 // 加载配置
@@ -28,6 +28,7 @@
 
 // project headers
 #include "data_structure/acceleration.h"
+#include "data_structure/acceleration_view.h"
 #include "data_structure/building.h"
 
 // 数据接口类的配置结构体
@@ -71,6 +72,15 @@ public:
     // @param file_path 文件路径
     void ReadFile(const std::string &file_path);
 
+    // 读取二进制记录，加速度数据直接使用内存映射的页面，同时读取建筑信息和
+    // 方向布局、采样频率、调幅系数的配置
+    // @param file_path 文件路径
+    void ReadBinaryFile(const std::string &file_path);
+
+    // 将当前的加速度数据、建筑信息和配置写入二进制记录
+    // @param file_path 文件路径
+    void WriteBinaryFile(const std::string &file_path) const;
+
     // 读取串口
     // @param port 串口号
     // @param baudrate 波特率
@@ -90,14 +100,20 @@ public:
         const std::string &building_file = "config/Building_Info.json");
 
 private:
-    // 读取得到的加速度数据
-    std::vector<data_structure::Acceleration> acc_;
+    // 读取得到的全部方向的加速度数据
+    data_structure::Acceleration all_acc_;
+
+    // 各方向的加速度视图，与all_acc_共享存储
+    std::vector<data_structure::AccelerationView> acc_;
 
     // 读取得到的建筑信息
     data_structure::Building building_;
 
     // 数据接口配置
     DataInterfaceConfig config_;
+
+    // 按配置的方向布局为all_acc_创建各方向的视图
+    void SplitDirections();
 };
 
 #endif // DATA_INTERFACE_H
\ No newline at end of file
@@ -21,10 +21,23 @@
 
 #include <QtWidgets/QApplication>
 
+#include "numerical_algorithm/fft_plan_cache.h"
+
+// FFTW wisdom文件，保存已测量的FFT计划
+const char *const kFftWisdomFile = "config/FFTW_Wisdom.dat";
+
 int main(int argc, char *argv[])
 {
+    // 读入上次保存的wisdom，相同长度的记录直接使用已测量的计划
+    auto &fft_plan_cache = numerical_algorithm::FftPlanCache::Global();
+    fft_plan_cache.set_planner_flags(FFTW_MEASURE);
+    fft_plan_cache.LoadWisdom(kFftWisdomFile);
+
     QApplication a(argc, argv);
     QRestMainWindow w;
     w.show();
-    return a.exec();
+    int result = a.exec();
+
+    fft_plan_cache.SaveWisdom(kFftWisdomFile);
+    return result;
 }
@@ -106,13 +106,9 @@ int BasedOnInterStoryDrift::TagSafty()
     // 获取采样频率
     double freq = inter_story_drift_.get_displacement().get_frequency();
 
-    // 获取最大层间位移角信息（索引）
-    auto pos_max_drift_idx =
-             inter_story_drift_.get_inter_story_drift().PositiveMax(),
-         neg_max_drift_idx =
-             inter_story_drift_.get_inter_story_drift().NegativeMax(),
-         abs_max_drift_idx =
-             inter_story_drift_.get_inter_story_drift().AbsoluteMax();
+    // 一次遍历获取最大层间位移角信息（索引）
+    auto drift_statistics =
+        inter_story_drift_.get_inter_story_drift().Statistics();
     // 初始化最大层间位移角结果
     all_max_idr_.pos_max_idr_time_.resize(story_number);
     all_max_idr_.neg_max_idr_time_.resize(story_number);
@@ -123,19 +119,19 @@ int BasedOnInterStoryDrift::TagSafty()
     {
         if (all_max_idr_.need_time_)
         {
-            all_max_idr_.pos_max_idr_time_.at(i) =
-                std::make_pair(pos_max_drift_idx[i].first,
-                               pos_max_drift_idx[i].second * 1.0 / freq);
-            all_max_idr_.neg_max_idr_time_.at(i) =
-                std::make_pair(neg_max_drift_idx[i].first,
-                               neg_max_drift_idx[i].second * 1.0 / freq);
-            all_max_idr_.abs_max_idr_time_.at(i) =
-                std::make_pair(abs_max_drift_idx[i].first,
-                               abs_max_drift_idx[i].second * 1.0 / freq);
+            all_max_idr_.pos_max_idr_time_.at(i) = std::make_pair(
+                drift_statistics[i].max_,
+                drift_statistics[i].max_index_ * 1.0 / freq);
+            all_max_idr_.neg_max_idr_time_.at(i) = std::make_pair(
+                drift_statistics[i].min_,
+                drift_statistics[i].min_index_ * 1.0 / freq);
+            all_max_idr_.abs_max_idr_time_.at(i) = std::make_pair(
+                drift_statistics[i].abs_max_,
+                drift_statistics[i].abs_max_index_ * 1.0 / freq);
         }
-        all_max_idr_.pos_max_idr_.push_back(pos_max_drift_idx[i].first);
-        all_max_idr_.neg_max_idr_.push_back(neg_max_drift_idx[i].first);
-        all_max_idr_.abs_max_idr_.push_back(abs_max_drift_idx[i].first);
+        all_max_idr_.pos_max_idr_.push_back(drift_statistics[i].max_);
+        all_max_idr_.neg_max_idr_.push_back(drift_statistics[i].min_);
+        all_max_idr_.abs_max_idr_.push_back(drift_statistics[i].abs_max_);
     }
 
     // 计算最大层间位移角
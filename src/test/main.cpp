@@ -15,9 +15,75 @@ int main()
     // 测试滤波器
     // test_filter();
 
+    // 测试二阶节滤波器
+    // test_sos_filter();
+
+    // 测试多通道同步滤波
+    // test_multichannel_filter();
+
+    // 测试流式滤波
+    // test_streaming_filter();
+
+    // 测试滤波器设计缓存
+    // test_filter_design_cache();
+
+    // 测试互相关和卷积
+    // test_correlation();
+
+    // 测试插值权重矩阵
+    // test_interp();
+
+    // 测试连续存储的矩阵
+    // test_column_matrix();
+
+    // 测试加速度视图
+    // test_acceleration_view();
+
+    // 测试统计量计算
+    // test_statistics();
+
+    // 测试单精度存储
+    // test_float_storage();
+
+    // 测试文本数据读取
+    // test_text_matrix_reader();
+
+    // 测试二进制记录格式
+    // test_binary_record();
+
+    // 测试加速度环形缓冲区
+    // test_ring_buffer();
+
+    // 测试惰性矩阵表达式
+    // test_matrix_expression();
+
+    // 测试惰性向量表达式
+    // test_vector_expression();
+
+    // 测试临时内存池
+    // test_scratch_arena();
+
+    // 测试反应谱的分段线性精确解法
+    // test_response_spectrum_solver();
+
+    // 测试反应谱的分批同步递推
+    // test_response_spectrum_batch();
+
+    // 测试多阻尼比反应谱
+    // test_multi_damping_spectrum();
+
+    // 测试反应谱横轴周期的生成
+    // test_period_grid();
+
+    // 测试FFTW计划缓存
+    // test_fft_plan_cache();
+
     // 测试改进的滤波积分算法
     // test_modified_filter_integrate();
 
+    // 测试频域零相位滤波的精度
+    // test_frequency_filtering();
+
     // 测试安全评价
     // test_safty_tagging();
 
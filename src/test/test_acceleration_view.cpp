@@ -0,0 +1,54 @@
+﻿#include <iostream>
+#include <vector>
+
+#include "data_structure/acceleration.h"
+#include "data_structure/acceleration_view.h"
+#include "data_structure/building.h"
+#include "edp_calculation/filtering_integral.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_acceleration_view()
+{
+    // 读取两个方向交错存储的加速度数据
+    auto data = ReadMatrixFromFile("acceleration_data/accNS.txt");
+    vector<vector<double>> two_direction;
+    for (const auto &col : data)
+    {
+        two_direction.push_back(col);
+        two_direction.push_back(col);
+    }
+    data_structure::Acceleration all(two_direction, 50);
+
+    // 按列选择一个方向，视图与加速度数据共享存储
+    vector<size_t> col_index;
+    for (size_t j = 0; j < data.size(); ++j)
+    {
+        col_index.push_back(2 * j);
+    }
+    data_structure::AccelerationView view(all, col_index);
+    cout << "shared: " << (view[1].data() == all.col(2).data()) << endl;
+
+    // 在视图上选择时间范围
+    auto slice = view.Slice(100, 200);
+    cout << "slice rows " << slice.get_row_number() << ", value "
+         << (slice(0, 1) == all.get_col(2)[100]) << endl;
+
+    // 由视图和复制得到的加速度数据计算的层间位移角相同
+    data_structure::Building building({0, 10, 20, 30}, {0, 10, 20, 30});
+    edp_calculation::FilteringIntegral from_view(view, building, 2, 0.1, 20);
+    from_view.CalculateEdp();
+    edp_calculation::FilteringIntegral from_copy(
+        data_structure::Acceleration(view), building, 2, 0.1, 20);
+    from_copy.CalculateEdp();
+    cout << "same drift: "
+         << (from_view.get_filtering_interp_result()
+                 .get_inter_story_drift()
+                 .get_data()
+             == from_copy.get_filtering_interp_result()
+                    .get_inter_story_drift()
+                    .get_data())
+         << endl;
+    return 0;
+}
@@ -0,0 +1,74 @@
+﻿#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "data_structure/acceleration.h"
+#include "data_structure/binary_record.h"
+#include "data_structure/building.h"
+#include "data_structure/text_matrix_reader.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_binary_record()
+{
+    // 将加速度数据写成文本格式
+    auto data = ReadMatrixFromFile("acceleration_data/accNS.txt");
+    const string text_path = "acceleration_data/binary_record.txt";
+    const string binary_path = "acceleration_data/binary_record.bin";
+    {
+        ofstream file(text_path);
+        file << setprecision(17);
+        for (size_t i = 0; i < data.front().size(); ++i)
+        {
+            for (size_t j = 0; j < data.size(); ++j)
+            {
+                file << data[j][i] << (j + 1 < data.size() ? " " : "\n");
+            }
+        }
+    }
+
+    // 文本格式转换为二进制记录
+    data_structure::Building building({0, 10, 20, 30}, {0, 5, 10, 15, 20, 30});
+    data_structure::BinaryRecordInfo info;
+    info.direction_ = 1;
+    info.mea_number_ = data.size();
+    info.scale_ = 0.01;
+    data_structure::ConvertTextToBinaryRecord(
+        text_path, binary_path, 50, building, info);
+
+    // 分别读取文本和二进制记录
+    data_structure::Acceleration from_text(
+        data_structure::ReadTextMatrix(text_path), 50, info.scale_);
+    auto record = data_structure::ReadBinaryRecord(binary_path);
+
+    cout << "same acceleration: "
+         << (record.acceleration_.get_data() == from_text.get_data())
+         << ", frequency " << record.acceleration_.get_frequency() << endl;
+    cout << "same building: "
+         << (record.building_.get_floor_height() == building.get_floor_height()
+             && record.building_.get_measuren_height()
+                    == building.get_measuren_height())
+         << ", layout " << record.info_.direction_ << " x "
+         << record.info_.mea_number_ << ", scale " << record.info_.scale_
+         << endl;
+
+    // 写时复制：修改读取的数据不影响文件
+    record.acceleration_.data()(0, 0) += 1.0;
+    auto reread = data_structure::ReadBinaryRecord(binary_path);
+    cout << "file unchanged: "
+         << (reread.acceleration_.get_data() == from_text.get_data()) << endl;
+
+    // 非二进制记录的文件
+    cout << "is binary: " << data_structure::IsBinaryRecord(binary_path) << " "
+         << data_structure::IsBinaryRecord(text_path) << endl;
+
+    record = data_structure::BinaryRecord();
+    reread = data_structure::BinaryRecord();
+    remove(text_path.c_str());
+    remove(binary_path.c_str());
+    return 0;
+}
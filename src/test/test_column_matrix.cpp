@@ -0,0 +1,67 @@
+﻿#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structure/acceleration.h"
+#include "data_structure/column_matrix.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_column_matrix()
+{
+    // 与std::vector<std::vector<double>>互相转换
+    vector<vector<double>> matrix{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}, {10, 11, 12}};
+    data_structure::ColumnMatrix column_matrix(matrix);
+    cout << "round trip: " << (column_matrix.to_vector() == matrix) << endl;
+
+    // 每列的起始地址按64字节对齐
+    bool aligned = true;
+    for (size_t j = 0; j < column_matrix.get_col_number(); ++j)
+    {
+        aligned = aligned
+                  && reinterpret_cast<uintptr_t>(column_matrix[j].data())
+                             % data_structure::ColumnMatrix::kAlignment
+                         == 0;
+    }
+    cout << "aligned: " << aligned << ", stride " << column_matrix.get_stride()
+         << endl;
+
+    // 改变大小时保留原有数据
+    column_matrix.resize(5, 2, -1.0);
+    for (size_t j = 0; j < column_matrix.get_col_number(); ++j)
+    {
+        for (auto value : column_matrix[j])
+        {
+            cout << value << " ";
+        }
+        cout << endl;
+    }
+
+    // 通过列视图修改数据
+    data_structure::Acceleration acceleration(matrix, 100.0);
+    auto col = acceleration.col(1);
+    col[0] = 100.0;
+    cout << "view: " << acceleration.get_col(1)[0] << " rows "
+         << acceleration.get_row_number() << " cols "
+         << acceleration.get_col_number() << endl;
+
+    // 外部存储须有持有者，矩阵不释放外部存储
+    alignas(data_structure::ColumnMatrix::kAlignment) double storage[8]{1, 2};
+    try
+    {
+        data_structure::ColumnMatrix external(storage, 2, 1, nullptr);
+    }
+    catch (const invalid_argument &e)
+    {
+        cout << e.what() << endl;
+    }
+    {
+        data_structure::ColumnMatrix external(
+            storage, 2, 1, shared_ptr<void>(storage, [](void *) {}));
+        cout << "external: " << external[0][1] << endl;
+    }
+    return 0;
+}
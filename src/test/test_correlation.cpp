@@ -0,0 +1,80 @@
+﻿#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "numerical_algorithm/vector_calculation.h"
+#include "test_function.h"
+
+using namespace std;
+
+// 两个序列的最大相对误差（相对于参考序列的最大绝对值）
+static double MaxError(const vector<double> &reference,
+                       const vector<double> &result)
+{
+    if (reference.size() != result.size())
+    {
+        return INFINITY;
+    }
+    double max_error = 0.0, max_value = 0.0;
+    for (size_t i = 0; i < reference.size(); ++i)
+    {
+        max_error = max(max_error, fabs(result[i] - reference[i]));
+        max_value = max(max_value, fabs(reference[i]));
+    }
+    return max_error / max_value;
+}
+
+int test_correlation()
+{
+    vector<double> input_signal;
+    ifstream input_file("acceleration_data/sig.txt");
+    double temp;
+    while (input_file >> temp)
+    {
+        input_signal.push_back(temp);
+    }
+    input_file.close();
+
+    // 直接计算与FFT计算的结果对比
+    vector<double> shifted(input_signal.begin() + 100, input_signal.end());
+    for (size_t size : {size_t(10), size_t(100), shifted.size()})
+    {
+        vector<double> y(shifted.begin(), shifted.begin() + size);
+        auto direct = numerical_algorithm::CrossCorrelationDirect(
+            input_signal, y);
+        auto fft = numerical_algorithm::CrossCorrelationFft(input_signal, y);
+        cout << "correlation " << input_signal.size() << "x" << size
+             << ": relative error " << MaxError(direct, fft) << endl;
+        cout << "convolution " << input_signal.size() << "x" << size
+             << ": relative error "
+             << MaxError(numerical_algorithm::ConvolutionDirect(input_signal, y),
+                         numerical_algorithm::ConvolutionFft(input_signal, y))
+             << endl;
+    }
+
+    // 互相关峰值位于移位100处
+    auto correlation = numerical_algorithm::CrossCorrelation(input_signal,
+                                                             shifted);
+    auto peak = max_element(correlation.begin(), correlation.end())
+                - correlation.begin();
+    cout << "peak shift: " << peak - static_cast<long>(shifted.size() - 1)
+         << endl;
+
+    // 批量互相关与逐个计算的结果对比
+    vector<vector<double>> signals{
+        shifted, input_signal, vector<double>(input_signal.begin(),
+                                              input_signal.begin() + 50)};
+    auto batch = numerical_algorithm::CrossCorrelation(input_signal, signals);
+    double max_error = 0.0;
+    for (size_t i = 0; i < signals.size(); ++i)
+    {
+        max_error = max(max_error,
+                        MaxError(batch[i],
+                                 numerical_algorithm::CrossCorrelation(
+                                     input_signal, signals[i])));
+    }
+    cout << "batch: max error " << max_error << endl;
+    return 0;
+}
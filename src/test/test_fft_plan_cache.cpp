@@ -0,0 +1,126 @@
+﻿#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "fftw3.h"
+#include "numerical_algorithm/fft_plan_cache.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_fft_plan_cache()
+{
+    // 长度为8的信号x[n] = 1 + cos(2πn/8) + sin(2π·2n/8)，
+    // 频谱X[0] = 8，X[1] = 4，X[2] = -4i，其余为0
+    const size_t size = 8;
+    const double pi = acos(-1.0);
+    vector<double> signal(size + 1);
+    for (size_t n = 0; n < size; ++n)
+    {
+        signal[n] = 1 + cos(2 * pi * n / size) + sin(4 * pi * n / size);
+    }
+    numerical_algorithm::FftPlanCache cache;
+    auto print = [](const vector<complex<double>> &spectrum) {
+        for (auto x : spectrum)
+        {
+            // 舍入到1e-6并消去负零
+            cout << round(x.real() * 1e6) / 1e6 + 0.0 << ","
+                 << round(x.imag() * 1e6) / 1e6 + 0.0 << " ";
+        }
+        cout << endl;
+    };
+    auto print_statistics = [&cache]() {
+        auto statistics = cache.get_statistics();
+        cout << "plans " << cache.get_size() << ", hit " << statistics.first
+             << ", miss " << statistics.second << endl;
+    };
+
+    // 1.首次变换创建计划，相同长度的第二次变换命中缓存
+    vector<complex<double>> spectrum(size / 2 + 1);
+    cache.Forward(size, signal.data(), spectrum.data());
+    print(spectrum); // 8,0 4,0 0,-4 0,0 0,0
+    cache.Forward(size, signal.data(), spectrum.data());
+    print_statistics(); // plans 1, hit 1, miss 1
+
+    // 2.输入未对齐时使用另一个计划，结果相同
+    vector<double> shifted(size + 1);
+    copy(signal.begin(), signal.begin() + size, shifted.begin() + 1);
+    cache.Forward(size, shifted.data() + 1, spectrum.data());
+    print(spectrum);    // 8,0 4,0 0,-4 0,0 0,0
+    print_statistics(); // plans 2, hit 1, miss 2
+
+    // 3.逆变换未归一化，除以长度后恢复原信号；输入会被覆盖，故先复制
+    vector<double> restored(size);
+    cache.Forward(size, signal.data(), spectrum.data());
+    auto copy_spectrum = spectrum;
+    cache.Backward(size, copy_spectrum.data(), restored.data());
+    double max_error = 0.0;
+    for (size_t n = 0; n < size; ++n)
+    {
+        max_error = max(max_error, abs(restored[n] / size - signal[n]));
+    }
+    cout << "round trip error < 1e-12: " << (max_error < 1e-12) << endl;
+    // round trip error < 1e-12: 1
+    print_statistics(); // plans 3, hit 2, miss 3
+
+    // 4.奇数长度：常数信号只有直流分量
+    vector<double> constant(5, 1.0);
+    vector<complex<double>> constant_spectrum(3);
+    cache.Forward(5, constant.data(), constant_spectrum.data());
+    print(constant_spectrum); // 5,0 0,0 0,0
+
+    // 5.多个线程同时变换相同长度，计划只创建一次，结果都相同
+    cache.Clear();
+    print_statistics(); // plans 0, hit 0, miss 0
+    vector<thread> threads;
+    vector<vector<complex<double>>> results(
+        4, vector<complex<double>>(size / 2 + 1));
+    for (size_t t = 0; t < results.size(); ++t)
+    {
+        threads.emplace_back([&, t]() {
+            cache.Forward(size, signal.data(), results[t].data());
+        });
+    }
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+    bool same = true;
+    for (const auto &result : results)
+    {
+        same = same && result == results[0];
+    }
+    cout << "same " << same << ", ";
+    print_statistics(); // same 1, plans 1, hit 3, miss 1
+
+    // 6.Get直接返回缓存中的计划，可用fftw_execute_dft_r2c重复执行
+    fftw_plan plan =
+        cache.Get(size, numerical_algorithm::FftDirection::forward, true);
+    fftw_execute_dft_r2c(plan,
+                         signal.data(),
+                         reinterpret_cast<fftw_complex *>(spectrum.data()));
+    print(spectrum);    // 8,0 4,0 0,-4 0,0 0,0
+    print_statistics(); // plans 1, hit 4, miss 1
+
+    // 7.规划方式只影响之后创建的计划
+    cache.set_planner_flags(FFTW_MEASURE);
+    cout << "measure " << (cache.get_planner_flags() == FFTW_MEASURE) << endl;
+    // measure 1
+    vector<double> twos(16, 2.0);
+    vector<complex<double>> twos_spectrum(9);
+    cache.Forward(16, twos.data(), twos_spectrum.data());
+    cout << twos_spectrum[0].real() << " " << abs(twos_spectrum[1]) << endl;
+    // 32 0
+    cache.set_planner_flags(FFTW_ESTIMATE);
+
+    // 8.保存和读入wisdom；文件不存在时读入失败
+    const string wisdom_file = "acceleration_data/fftw_wisdom.dat";
+    cout << "save " << cache.SaveWisdom(wisdom_file) << ", load "
+         << cache.LoadWisdom(wisdom_file) << ", missing "
+         << cache.LoadWisdom("acceleration_data/no_such_wisdom.dat") << endl;
+    // save 1, load 1, missing 0
+    return 0;
+}
@@ -0,0 +1,47 @@
+﻿#include <iostream>
+#include <vector>
+
+#include "numerical_algorithm/butterworth_filter_design.h"
+#include "numerical_algorithm/filter_design_cache.h"
+
+using namespace std;
+
+int test_filter_design_cache()
+{
+    numerical_algorithm::FilterDesignCache cache(200);
+
+    // 1.缓存的设计与直接设计的结果相同
+    auto cached = cache.Get(2, 0.01, 0.8);
+    numerical_algorithm::ButterworthFilterDesign design(2, 0.01, 0.8);
+    vector<double> a, b, cached_a, cached_b;
+    design.get_filter_coefficients(a, b);
+    cached->get_filter_coefficients(cached_a, cached_b);
+    cout << "identical: " << (a == cached_a && b == cached_b) << endl;
+    cout << "shared: " << (cached == cache.Get(2, 0.01, 0.8)) << endl;
+
+    // 2.低频截止频率扫描：预先设计后逐个获取都命中缓存
+    vector<pair<double, double>> bands;
+    for (int k = 0; k < 100; ++k)
+    {
+        bands.emplace_back(0.04 * (k + 1) / 100, 0.6);
+    }
+    cache.Prewarm(2, bands);
+    for (const auto &band : bands)
+    {
+        cache.Get(2, band.first, band.second);
+    }
+    auto print_statistics = [&cache]() {
+        auto statistics = cache.get_statistics();
+        cout << "size: " << cache.get_size() << ", hit: " << statistics.first
+             << ", miss: " << statistics.second << endl;
+    };
+    print_statistics(); // size: 101, hit: 101, miss: 101
+
+    // 3.超出容量时淘汰最久未使用的设计
+    cache.set_capacity(50);
+    print_statistics(); // size: 50, hit: 101, miss: 101
+    cache.Get(2, bands.back().first, bands.back().second);
+    cache.Get(2, 0.01, 0.8);
+    print_statistics(); // size: 50, hit: 102, miss: 102
+    return 0;
+}
@@ -0,0 +1,85 @@
+﻿#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "data_structure/acceleration.h"
+#include "data_structure/acceleration_view.h"
+#include "data_structure/building.h"
+#include "edp_calculation/filtering_integral.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_float_storage()
+{
+    auto data = ReadMatrixFromFile("acceleration_data/accNS.txt");
+    data_structure::Acceleration acceleration(data, 50);
+    data_structure::Building building({0, 10, 20, 30}, {0, 10, 20, 30});
+
+    // 双精度存储时计算的层间位移角作为参考
+    edp_calculation::FilteringIntegral reference(
+        acceleration, building, 2, 0.1, 20);
+    reference.CalculateEdp();
+    auto reference_drift = reference.get_filtering_interp_result()
+                               .get_inter_story_drift()
+                               .get_data();
+
+    // 转换为单精度存储，内存减半，读取的数据为舍入到float的值
+    auto bytes = acceleration.get_matrix().get_stride()
+                 * acceleration.get_col_number() * sizeof(double);
+    auto original = acceleration.get_data();
+    acceleration.set_precision(data_structure::StoragePrecision::float32);
+    const auto &matrix = acceleration.get_float_matrix();
+    cout << "bytes " << bytes << " -> "
+         << matrix.get_stride() * matrix.get_col_number() * sizeof(float)
+         << endl;
+    double max_error = 0.0;
+    auto stored = acceleration.get_data();
+    for (size_t j = 0; j < stored.size(); ++j)
+    {
+        for (size_t i = 0; i < stored[j].size(); ++i)
+        {
+            max_error = max(max_error, fabs(stored[j][i] - original[j][i]));
+        }
+    }
+    cout << "max rounding error " << max_error << endl;
+
+    // 层间加速度保持单精度存储，统计量在double下累加
+    auto interstory = acceleration.interstory_acceleration();
+    cout << "interstory float32: "
+         << (interstory.get_precision()
+             == data_structure::StoragePrecision::float32)
+         << ", abs max " << interstory.Statistics()[0].abs_max_ << endl;
+
+    // 由单精度存储的加速度计算层间位移角，积分和滤波仍在double下进行
+    edp_calculation::FilteringIntegral from_float(
+        acceleration, building, 2, 0.1, 20);
+    from_float.CalculateEdp();
+    auto drift = from_float.get_filtering_interp_result()
+                     .get_inter_story_drift()
+                     .get_data();
+    double max_drift = 0.0, drift_error = 0.0;
+    for (size_t j = 0; j < drift.size(); ++j)
+    {
+        for (size_t i = 0; i < drift[j].size(); ++i)
+        {
+            max_drift = max(max_drift, fabs(reference_drift[j][i]));
+            drift_error =
+                max(drift_error, fabs(drift[j][i] - reference_drift[j][i]));
+        }
+    }
+    cout << "drift relative error " << drift_error / max_drift << endl;
+
+    // 单精度存储时不能获取双精度的列视图
+    try
+    {
+        acceleration.col(0);
+        cout << "no exception" << endl;
+    }
+    catch (const logic_error &e)
+    {
+        cout << "expected exception: " << e.what() << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,122 @@
+﻿#include "data_structure/acceleration.h"
+#include "data_structure/building.h"
+#include "test_function.h"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "edp_calculation/modified_filtering_integral.h"
+#include "numerical_algorithm/butterworth_filter_design.h"
+#include "numerical_algorithm/filtfilt.h"
+#include "numerical_algorithm/frequency_filtering.h"
+#include "numerical_algorithm/integral.h"
+
+
+using namespace std;
+
+// 相对均方根误差，interior为真时只统计去掉两端各10%后的区间
+static double RelativeError(const vector<double> &reference,
+                            const vector<double> &result,
+                            bool interior = false)
+{
+    size_t beg = interior ? reference.size() / 10 : 0;
+    size_t end = reference.size() - beg;
+    double error = 0.0, norm = 0.0;
+    for (size_t i = beg; i < end; ++i)
+    {
+        error += (reference[i] - result[i]) * (reference[i] - result[i]);
+        norm += reference[i] * reference[i];
+    }
+    return sqrt(error / norm);
+}
+
+void test_frequency_filtering()
+{
+    // 读取数据文件
+    string file_name = "acceleration_data/accNS.txt";
+    auto acceleration = data_structure::Acceleration(
+        std::vector<std::vector<double>>(), 50, 0.01);
+    acceleration.data() = ReadMatrixFromFile(file_name);
+    const auto signal = acceleration.get_col(0);
+    double dt = acceleration.get_time_step();
+
+    // 1.不同低频截止频率下，单次零相位滤波和“滤波-积分-滤波-积分-滤波”
+    // 全过程与时域filtfilt的相对误差
+    numerical_algorithm::FrequencyFiltering frequency_filter;
+    frequency_filter.SetSignal(signal);
+    numerical_algorithm::FrequencyFiltering::Workspace workspace;
+    cout << "low\tfilter\tfilter(interior)\tchain\tchain(interior)" << endl;
+    for (double low : {0.0004, 0.001, 0.004, 0.01, 0.02, 0.04})
+    {
+        numerical_algorithm::ButterworthFilterDesign butter(2, low, 0.8);
+        numerical_algorithm::FiltFilt filtfilt(butter);
+        vector<double> a, b, response, filtered, displacement;
+        butter.get_filter_coefficients(a, b);
+
+        // 单次零相位滤波
+        frequency_filter.ZeroPhaseResponse(a, b, response);
+        frequency_filter.ApplyResponse(response, filtered, workspace);
+        auto filtered_reference = filtfilt.Filtering(signal);
+
+        // 滤波积分全过程
+        for (auto &value : response)
+        {
+            value = value * value * value;
+        }
+        frequency_filter.ApplyResponse(
+            response, displacement, workspace, 2, dt);
+        auto displacement_reference = filtfilt.Filtering(
+            numerical_algorithm::Cumtrapz(
+                filtfilt.Filtering(numerical_algorithm::Cumtrapz(
+                    filtfilt.Filtering(signal), dt)),
+                dt));
+
+        cout << low << "\t" << RelativeError(filtered_reference, filtered)
+             << "\t" << RelativeError(filtered_reference, filtered, true)
+             << "\t" << RelativeError(displacement_reference, displacement)
+             << "\t"
+             << RelativeError(displacement_reference, displacement, true)
+             << endl;
+    }
+
+    // 2.改进的滤波积分法在两种扫描方式下的层间位移角
+    std::vector<double> floor, measurement;
+    std::ifstream ifs("building/floor.txt");
+    double temp;
+    while (ifs >> temp)
+    {
+        floor.push_back(temp);
+    }
+    ifs.close();
+    ifs.open("building/measurement.txt");
+    while (ifs >> temp)
+    {
+        measurement.push_back(temp);
+    }
+    ifs.close();
+    auto building = data_structure::Building(measurement, floor);
+
+    edp_calculation::ModifiedFilteringIntegral time_domain(
+        acceleration, building, 2);
+    time_domain.CalculateEdp();
+    edp_calculation::ModifiedFilteringIntegral frequency_domain(
+        acceleration, building, 2);
+    frequency_domain.get_sweep_parameter().engine_ =
+        edp_calculation::SweepEngine::frequency_domain;
+    frequency_domain.CalculateEdp();
+
+    const auto &drift_reference =
+        time_domain.get_filtering_interp_result().get_inter_story_drift();
+    const auto &drift =
+        frequency_domain.get_filtering_interp_result().get_inter_story_drift();
+    cout << "story\tdrift error" << endl;
+    for (size_t i = 0; i < drift.get_col_number(); ++i)
+    {
+        cout << i + 1 << "\t"
+             << RelativeError(drift_reference.get_col(i), drift.get_col(i))
+             << endl;
+    }
+}
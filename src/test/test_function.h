@@ -13,12 +13,78 @@ int test_butter();
 // 测试滤波器
 int test_filter();
 
+// 测试二阶节滤波器
+int test_sos_filter();
+
+// 测试多通道同步滤波
+int test_multichannel_filter();
+
+// 测试流式滤波
+int test_streaming_filter();
+
+// 测试滤波器设计缓存
+int test_filter_design_cache();
+
+// 测试直接计算与FFT计算的互相关和卷积
+int test_correlation();
+
+// 测试插值权重矩阵与逐时刻插值的结果对比
+void test_interp();
+
+// 测试列主序连续存储的矩阵
+int test_column_matrix();
+
+// 测试加速度视图
+int test_acceleration_view();
+
+// 测试一次遍历的统计量计算
+int test_statistics();
+
+// 测试单精度存储
+int test_float_storage();
+
+// 测试文本数据的快速读取
+int test_text_matrix_reader();
+
+// 测试二进制记录格式的读写
+int test_binary_record();
+
+// 测试加速度环形缓冲区
+int test_ring_buffer();
+
+// 测试惰性矩阵表达式
+int test_matrix_expression();
+
+// 测试惰性向量表达式
+int test_vector_expression();
+
+// 测试临时内存池
+int test_scratch_arena();
+
+// 测试反应谱的分段线性精确解法
+int test_response_spectrum_solver();
+
+// 测试反应谱的分批同步递推
+int test_response_spectrum_batch();
+
+// 测试多阻尼比反应谱
+int test_multi_damping_spectrum();
+
+// 测试反应谱横轴周期的生成
+int test_period_grid();
+
+// 测试FFTW计划缓存
+int test_fft_plan_cache();
+
 // 测试滤波积分算法
 void test_filter_integrate();
 
 // 测试改进的滤波积分算法
 void test_modified_filter_integrate();
 
+// 测试频域零相位滤波与时域filtfilt的精度对比
+void test_frequency_filtering();
+
 // 测试EDP计算模块
 void test_edp_library(const std::string &file_name);
 
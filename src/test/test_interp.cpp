@@ -0,0 +1,56 @@
+﻿#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "data_structure/building.h"
+#include "numerical_algorithm/interp.h"
+#include "test_function.h"
+
+using namespace std;
+
+void test_interp()
+{
+    // 读取建筑信息和测点数据
+    std::vector<double> floor, measurement;
+    std::ifstream ifs("building/floor.txt");
+    double temp;
+    while (ifs >> temp)
+    {
+        floor.push_back(temp);
+    }
+    ifs.close();
+    ifs.open("building/measurement.txt");
+    while (ifs >> temp)
+    {
+        measurement.push_back(temp);
+    }
+    ifs.close();
+    auto building = data_structure::Building(measurement, floor);
+    auto data = ReadMatrixFromFile("acceleration_data/accNS.txt");
+
+    // 逐时刻GSL插值与插值权重矩阵的结果对比
+    for (auto interp_type : {numerical_algorithm::InterpType::Linear,
+                             numerical_algorithm::InterpType::CubicSpline,
+                             numerical_algorithm::InterpType::Polynomial})
+    {
+        numerical_algorithm::Interp interp(interp_type);
+        auto reference = interp.Interpolation(measurement, data, floor);
+        auto result = interp.Interpolation(
+            building.get_interp_weight(interp_type), data);
+
+        double max_error = 0.0;
+        for (size_t i = 0; i < result.size(); ++i)
+        {
+            for (size_t j = 0; j < result[i].size(); ++j)
+            {
+                max_error =
+                    max(max_error, fabs(result[i][j] - reference[i][j]));
+            }
+        }
+        cout << "type " << static_cast<int>(interp_type) << ": max error "
+             << max_error << endl;
+    }
+}
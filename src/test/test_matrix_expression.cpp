@@ -0,0 +1,84 @@
+﻿#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structure/displacement.h"
+#include "data_structure/matrix_expression.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_matrix_expression()
+{
+    // 4个测点（底层和3层），3个时刻，每列为一个测点
+    vector<vector<double>> matrix{
+        {0, 1, 2}, {1, 3, 5}, {3, 6, 9}, {6, 10, 14}};
+    data_structure::Displacement displacement(matrix, 50);
+    vector<double> height{2, 4, 5};
+    auto print = [](const data_structure::ColumnMatrix &result) {
+        for (const auto &col : result.to_vector())
+        {
+            for (auto value : col)
+            {
+                cout << value << " ";
+            }
+            cout << "; ";
+        }
+        cout << endl;
+    };
+
+    // 层间位移角：层间差除以层高
+    auto drift = data_structure::DivideColumns(
+                     data_structure::InterstoryDifference(
+                         data_structure::MakeExpression(
+                             displacement.get_matrix())),
+                     height)
+                     .Evaluate();
+    print(drift); // 0.5 1 1.5 ; 0.5 0.75 1 ; 0.6 0.8 1 ;
+    cout << "same as interstory: "
+         << (data_structure::InterstoryDifference(
+                 data_structure::MakeExpression(displacement.get_matrix()))
+                 .Evaluate()
+                 .to_vector()
+             == displacement.interstory_displacement().get_data())
+         << endl; // 1
+
+    // 相对底层的差乘以系数，写入单精度矩阵
+    auto relative = data_structure::ScaleColumns(
+        data_structure::RelativeDifference(
+            data_structure::MakeExpression(displacement.get_matrix())),
+        height);
+    print(relative.Evaluate()); // 2 4 6 ; 12 20 28 ; 30 45 60 ;
+    data_structure::FloatColumnMatrix relative_float;
+    relative.EvaluateTo(relative_float);
+    cout << relative(2, 1) << " " << relative_float(2, 1) << endl; // 28 28
+
+    // 只有一列时差为空矩阵；没有列或系数不足时抛出异常
+    data_structure::ColumnMatrix one_column(3, 1, 1.0), empty;
+    auto none = data_structure::RelativeDifference(
+                    data_structure::MakeExpression(one_column))
+                    .Evaluate();
+    cout << none.get_row_number() << " x " << none.get_col_number()
+         << endl; // 3 x 0
+    try
+    {
+        data_structure::InterstoryDifference(
+            data_structure::MakeExpression(empty));
+    }
+    catch (const invalid_argument &e)
+    {
+        cout << e.what() << endl; // The matrix has no column.
+    }
+    try
+    {
+        data_structure::ScaleColumns(
+            data_structure::MakeExpression(displacement.get_matrix()),
+            height);
+    }
+    catch (const invalid_argument &e)
+    {
+        cout << e.what() << endl;
+        // The number of factors is less than the column number.
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+﻿#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "gmp_calculation/gmp_calculation.h"
+#include "gmp_calculation/response_spectrum_solver.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_multi_damping_spectrum()
+{
+    // t = 0起的单位阶跃，采样频率50Hz，2s；周期0.5s和1s，阻尼比0和0.05
+    vector<double> step(100, 1.0);
+    const vector<double> damping_ratios = {0.0, 0.05};
+
+    using gmp_calculation::ResponseSpectrumSolver;
+    for (auto solver : {ResponseSpectrumSolver::newmark_beta,
+                        ResponseSpectrumSolver::piecewise_linear})
+    {
+        gmp_calculation::GmpCalculation gmp(step, 50.0);
+        gmp.set_response_spectrum_solver(solver);
+        gmp.set_response_spectrum_periods({0.5, 1.0});
+
+        // 一次计算的结果与逐个阻尼比重新计算的结果逐位相同
+        auto surface = gmp.MultiDampingResponseSpectrum(damping_ratios);
+        bool same = surface.periods == vector<double>{0.5, 1.0}
+                    && surface.Sa.size() == 4;
+        for (size_t i = 0; i < damping_ratios.size(); ++i)
+        {
+            gmp.set_damping_ratio(damping_ratios[i]);
+            auto reference = gmp.ResponseSpectrum();
+            auto row = surface.at(i);
+            same = same && row.Sa == reference.Sa && row.Sv == reference.Sv
+                   && row.Sd == reference.Sd;
+        }
+        cout << "solver " << static_cast<int>(solver) << ", same: " << same
+             << endl;
+    }
+    // solver 0, same: 1
+    // solver 1, same: 1
+
+    // 分段线性精确解，谱值按阻尼比逐行存储。无阻尼时绝对加速度为1 - cos ωt，
+    // T = 1s的峰值恰在采样时刻，为2；T = 0.5s的峰值在两个采样时刻之间，为
+    // 1 - cos 0.96π。5%阻尼时绝对加速度的峰值在ωt略小于π处，两个周期都在
+    // ωt = 0.96π的采样时刻取得峰值1.85839
+    gmp_calculation::GmpCalculation gmp(step, 50.0);
+    gmp.set_response_spectrum_solver(ResponseSpectrumSolver::piecewise_linear);
+    gmp.set_response_spectrum_periods({0.5, 1.0});
+    auto surface = gmp.MultiDampingResponseSpectrum(damping_ratios);
+    for (auto value : surface.Sa)
+    {
+        cout << value << " ";
+    }
+    cout << endl; // 1.99211 2 1.85839 1.85839
+
+    // 没有阻尼比时结果为空，阻尼比的序号越界时抛出异常
+    cout << gmp.MultiDampingResponseSpectrum({}).Sa.size() << endl; // 0
+    try
+    {
+        surface.at(2);
+    }
+    catch (const out_of_range &e)
+    {
+        cout << e.what() << endl; // The damping index is out of range.
+    }
+    return 0;
+}
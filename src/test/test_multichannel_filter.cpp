@@ -0,0 +1,67 @@
+﻿#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "numerical_algorithm/butterworth_filter_design.h"
+#include "numerical_algorithm/filtfilt.h"
+#include "numerical_algorithm/multichannel_filter.h"
+
+using namespace std;
+
+int test_multichannel_filter()
+{
+    // 读取信号，各通道为同一信号的不同缩放
+    vector<double> input_signal;
+    ifstream input_file("acceleration_data/sig.txt");
+    double temp;
+    while (input_file >> temp)
+    {
+        input_signal.push_back(temp);
+    }
+    input_file.close();
+
+    cout << "SIMD level: "
+         << static_cast<int>(numerical_algorithm::DetectSimdLevel()) << endl;
+
+    // 多通道同步滤波与逐列滤波的结果对比
+    numerical_algorithm::ButterworthFilterDesign design(2, 0.01, 0.2);
+    for (auto structure :
+         {numerical_algorithm::FilterStructure::transfer_function,
+          numerical_algorithm::FilterStructure::second_order_sections})
+    {
+        numerical_algorithm::FiltFilt filtfilt(design, structure);
+        for (size_t channel_number : {1, 3, 9, 16, 30})
+        {
+            vector<vector<double>> input(channel_number, input_signal);
+            for (size_t c = 0; c < channel_number; ++c)
+            {
+                for (auto &value : input[c])
+                {
+                    value *= 1.0 + 0.1 * c;
+                }
+            }
+
+            auto output = filtfilt.Filtering(input);
+            vector<vector<double>> reference(channel_number);
+            for (size_t c = 0; c < channel_number; ++c)
+            {
+                reference[c] = filtfilt.Filtering(input[c]);
+            }
+
+            double max_error = 0.0;
+            for (size_t c = 0; c < channel_number; ++c)
+            {
+                for (size_t i = 0; i < output[c].size(); ++i)
+                {
+                    max_error = max(max_error,
+                                    fabs(output[c][i] - reference[c][i]));
+                }
+            }
+            cout << "structure " << static_cast<int>(structure)
+                 << ", channels " << channel_number
+                 << ": max error " << max_error << endl;
+        }
+    }
+    return 0;
+}
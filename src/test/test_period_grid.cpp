@@ -0,0 +1,104 @@
+﻿#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "gmp_calculation/gmp_calculation.h"
+#include "gmp_calculation/period_grid.h"
+#include "gmp_library/gmp_library.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_period_grid()
+{
+    auto print = [](const vector<double> &periods) {
+        for (auto period : periods)
+        {
+            cout << period << " ";
+        }
+        cout << endl;
+    };
+
+    // 对数分布的周期，首尾恰为最小周期和最大周期，相邻周期之比为常数
+    print(gmp_calculation::LogarithmicPeriods(0.1, 10, 5));
+    // 0.1 0.316228 1 3.16228 10
+    print(gmp_calculation::LogarithmicPeriods(0.5, 0.5, 1)); // 0.5
+    // 等间隔分布的周期不超过最大周期，最大周期小于步长时为空
+    print(gmp_calculation::UniformPeriods(0.5, 2));   // 0.5 1 1.5 2
+    print(gmp_calculation::UniformPeriods(0.5, 0.4)); // （空）
+
+    // 无效的周期范围、周期数和自定义周期
+    auto check = [](auto function) {
+        try
+        {
+            function();
+            cout << "not thrown" << endl;
+        }
+        catch (const invalid_argument &e)
+        {
+            cout << e.what() << endl;
+        }
+    };
+    check([] { gmp_calculation::LogarithmicPeriods(0, 5, 10); });
+    check([] { gmp_calculation::LogarithmicPeriods(5, 1, 10); });
+    check([] { gmp_calculation::LogarithmicPeriods(1, 5, 1); });
+    check([] { gmp_calculation::LogarithmicPeriods(1, 5, 0); });
+    check([] { gmp_calculation::UniformPeriods(0, 5); });
+    check([] { gmp_calculation::CheckPeriods({0.1, -1}); });
+    check([] {
+        gmp_calculation::CheckPeriods(
+            {0.1, numeric_limits<double>::infinity()});
+    });
+    // The periods must satisfy 0 < min_period <= max_period.（2次）
+    // The period number is too small for the period range.（2次）
+    // The period step must be positive.
+    // The periods must be positive and finite.（2次）
+
+    // 自定义周期：t = 0起的单位阶跃，无阻尼时T = 1s的Sa为2，与单个周期的
+    // 计算结果相同；拟加速度谱为ω²Sd
+    vector<double> step(100, 1.0);
+    gmp_calculation::GmpCalculation gmp(step, 50.0, 0.0);
+    gmp.set_response_spectrum_solver(
+        gmp_calculation::ResponseSpectrumSolver::piecewise_linear);
+    gmp.set_response_spectrum_periods({1.0, 0.25});
+    auto spectrum = gmp.ResponseSpectrum();
+    print(spectrum.periods); // 1 0.25
+    cout << spectrum.Sa[0] << " "
+         << (spectrum.Sa[1] == gmp.AccelerationSpectrumTi(0.25)) << endl;
+    // 2 1
+    auto pseudo = gmp.PseudoResponseSpectrum();
+    cout << pseudo.Sa[0] << " " << 4 * M_PI * M_PI * spectrum.Sd[0]
+         << endl; // 2 2
+
+    // 设置无效的周期时抛出异常，原有设置不变
+    check([&gmp] { gmp.set_logarithmic_periods(1, 5, 1); });
+    print(gmp.ResponseSpectrum().periods); // 1 0.25
+    gmp.set_logarithmic_periods(0.1, 10, 3);
+    print(gmp.ResponseSpectrum().periods); // 0.1 1 10
+
+    // C接口（默认为Newmark-β法）：参数无效时返回nullptr，不抛出异常
+    double custom[] = {1.0, 0.25};
+    auto result =
+        GetResponseSpectrumAtPeriods(step.data(), 100, 50.0, 0.0, custom, 2);
+    cout << result->result_size << " " << result->Sa[0] << " " << result->dt
+         << endl; // 2 1.99999 0
+    FreeResponseSpectrum(result);
+    double invalid[] = {1.0, -0.25};
+    cout << (GetResponseSpectrumAtPeriods(
+                 step.data(), 100, 50.0, 0.0, custom, -2)
+             == nullptr)
+         << (GetPseudoResponseSpectrumAtPeriods(
+                 step.data(), 100, 50.0, 0.0, invalid, 2)
+             == nullptr)
+         << (GetResponseSpectrumAtPeriods(nullptr, 100, 50.0, 0.0, custom, 2)
+             == nullptr)
+         << (GetLogarithmicPeriods(0, 5, 10) == nullptr)
+         << (GetLogarithmicPeriods(1, 5, -1) == nullptr) << endl; // 11111
+    auto periods = GetLogarithmicPeriods(0.1, 10, 3);
+    cout << periods[0] << " " << periods[1] << " " << periods[2] << endl;
+    // 0.1 1 10
+    FreeArray(periods);
+    return 0;
+}
@@ -0,0 +1,72 @@
+﻿#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "gmp_calculation/response_spectrum_solver.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_response_spectrum_batch()
+{
+    // 确定的地面加速度：t = 0起的阶跃加上一个正弦，采样频率50Hz，8s
+    const double time_step = 0.02;
+    vector<double> acceleration(400);
+    for (size_t i = 0; i < acceleration.size(); ++i)
+    {
+        acceleration[i] = 1.0 + 0.5 * sin(2 * M_PI * 3 * i * time_step);
+    }
+
+    // 60个周期（3批16个和不满一批的12个），阻尼比0和0.05交替
+    vector<gmp_calculation::PiecewiseLinearCoefficients> coefficients;
+    for (int i = 1; i <= 60; ++i)
+    {
+        coefficients.emplace_back(i * 0.02, i % 2 == 0 ? 0.0 : 0.05, time_step);
+    }
+
+    // 逐个周期计算的结果
+    vector<gmp_calculation::SdofPeakResponse> reference;
+    for (const auto &k : coefficients)
+    {
+        reference.push_back(gmp_calculation::PiecewiseLinearPeakResponse(
+            acceleration.data(), acceleration.size(), k));
+    }
+
+    // 分批同步递推，单线程、3个线程和硬件线程数的结果与逐个周期计算逐位相同
+    for (size_t thread_number : {1, 3, 0})
+    {
+        auto result =
+            gmp_calculation::PiecewiseLinearSpectrum(acceleration.data(),
+                                                     acceleration.size(),
+                                                     coefficients,
+                                                     thread_number);
+        bool same = result.size() == reference.size();
+        for (size_t i = 0; same && i < result.size(); ++i)
+        {
+            same = result[i].acceleration_ == reference[i].acceleration_
+                   && result[i].velocity_ == reference[i].velocity_
+                   && result[i].displacement_ == reference[i].displacement_;
+        }
+        cout << thread_number << " threads: same " << same << endl;
+    }
+    // 1 threads: same 1
+    // 3 threads: same 1
+    // 0 threads: same 1
+
+    // 只有阶跃时，无阻尼体系T = 1s（第50个周期）的绝对加速度峰值为2
+    vector<double> step(100, 1.0);
+    auto step_result = gmp_calculation::PiecewiseLinearSpectrum(
+        step.data(), step.size(), coefficients);
+    cout << "step: " << step_result[49].acceleration_ << endl; // step: 2
+
+    // 没有周期时结果为空，没有地面加速度时响应为0
+    cout << gmp_calculation::PiecewiseLinearSpectrum(
+                acceleration.data(), acceleration.size(), {})
+                .size()
+         << " "
+         << gmp_calculation::PiecewiseLinearSpectrum(
+                acceleration.data(), 0, coefficients)[0]
+                .acceleration_
+         << endl; // 0 0
+    return 0;
+}
@@ -0,0 +1,97 @@
+﻿#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "gmp_calculation/gmp_calculation.h"
+#include "gmp_calculation/response_spectrum_solver.h"
+#include "test_function.h"
+
+using namespace std;
+
+// 参考解：时间步长加密refine倍（步内线性插值）后用Newmark-β法积分，只在原采样
+// 时刻取峰值，与分段线性激励的精确解只差加密后很小的截断误差
+static double ReferenceSa(const vector<double> &acceleration,
+                          double time_step,
+                          double period,
+                          double damping_ratio,
+                          int refine)
+{
+    double dt = time_step / refine, omega = 2 * M_PI / period;
+    double k = omega * omega, c = 2 * damping_ratio * omega;
+    double k_b = k + 4 / (dt * dt) + 2 * c / dt;
+    double u = 0, v = 0, a = -acceleration[0], max_a = 0;
+    for (size_t i = 1; i < acceleration.size(); ++i)
+    {
+        for (int j = 1; j <= refine; ++j)
+        {
+            double ag = acceleration[i - 1]
+                        + (acceleration[i] - acceleration[i - 1]) * j / refine;
+            double p = -ag + (4 / (dt * dt) + 2 * c / dt) * u
+                       + (4 / dt + c) * v + a;
+            double u_next = p / k_b;
+            double v_next = 2 / dt * (u_next - u) - v;
+            a = 4 / (dt * dt) * (u_next - u) - 4 / dt * v - a;
+            u = u_next;
+            v = v_next;
+        }
+        max_a = max(max_a, fabs(a + acceleration[i]));
+    }
+    return max_a;
+}
+
+int test_response_spectrum_solver()
+{
+    // 无阻尼时状态转移矩阵为旋转矩阵：T = 1s，时间步长0.125s（ωΔt = π/4）
+    gmp_calculation::PiecewiseLinearCoefficients undamped(1.0, 0.0, 0.125);
+    cout << undamped.a11_ << " " << undamped.a12_ * 2 * M_PI << " "
+         << undamped.a21_ / (2 * M_PI) << " " << undamped.a22_ << endl;
+    // 0.707107 0.707107 -0.707107 0.707107
+
+    // 无阻尼体系受阶跃加速度（t = 0起为1）：u = -(1 - cos ωt) / ω²，
+    // 绝对加速度峰值为2，位移峰值为2 / ω²，T = 1s、Δt = 0.02s时峰值恰在第25步
+    vector<double> step(100, 1.0);
+    gmp_calculation::PiecewiseLinearCoefficients coefficients(1.0, 0.0, 0.02);
+    auto peak = gmp_calculation::PiecewiseLinearPeakResponse(
+        step.data(), step.size(), coefficients);
+    cout << peak.acceleration_ << " " << peak.displacement_ * 4 * M_PI * M_PI
+         << " " << peak.velocity_ * 2 * M_PI << endl;
+    // 2 2 0.998027（速度峰值在第12.5步，取sin(0.48π)）
+
+    // 静止的地面：响应为0
+    vector<double> still(10, 0.0);
+    peak = gmp_calculation::PiecewiseLinearPeakResponse(
+        still.data(), still.size(), coefficients);
+    cout << peak.acceleration_ << " " << peak.velocity_ << " "
+         << peak.displacement_ << endl; // 0 0 0
+
+    // 确定的地面加速度（两个正弦之和），50Hz，20s；周期接近时间步长时分段线性
+    // 解法与参考解一致，Newmark-β法误差明显
+    const double frequency = 50;
+    vector<double> acceleration(1000);
+    for (size_t i = 0; i < acceleration.size(); ++i)
+    {
+        double t = i / frequency;
+        acceleration[i] = sin(2 * M_PI * 1.3 * t) + 0.5 * sin(2 * M_PI * 7 * t);
+    }
+    gmp_calculation::GmpCalculation gmp(acceleration, frequency, 0.05);
+    auto newmark = gmp.ResponseSpectrum();
+    gmp.set_response_spectrum_solver(
+        gmp_calculation::ResponseSpectrumSolver::piecewise_linear);
+    auto piecewise = gmp.ResponseSpectrum();
+    for (double period : {0.02, 0.05, 0.5})
+    {
+        double reference =
+            ReferenceSa(acceleration, 1 / frequency, period, 0.05, 100);
+        int index = static_cast<int>(round(period / 0.01)) - 1;
+        cout << "T = " << period << " s: piecewise linear error < 1e-4: "
+             << (fabs(piecewise.Sa[index] - reference) / reference < 1e-4)
+             << ", newmark error < 1e-4: "
+             << (fabs(newmark.Sa[index] - reference) / reference < 1e-4)
+             << endl;
+    }
+    // T = 0.02 s: piecewise linear error < 1e-4: 1, newmark error < 1e-4: 0
+    // T = 0.05 s: piecewise linear error < 1e-4: 1, newmark error < 1e-4: 0
+    // T = 0.5 s: piecewise linear error < 1e-4: 1, newmark error < 1e-4: 0
+    return 0;
+}
@@ -0,0 +1,87 @@
+﻿#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "data_structure/acceleration_ring_buffer.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_ring_buffer()
+{
+    // 2个通道，容量4；第k个样本第j个通道的值为k * 100 + j
+    auto samples = [](size_t first, size_t number, size_t channel_number) {
+        vector<double> result;
+        for (size_t k = first; k < first + number; ++k)
+        {
+            for (size_t j = 0; j < channel_number; ++j)
+            {
+                result.push_back(static_cast<double>(k * 100 + j));
+            }
+        }
+        return result;
+    };
+    auto print = [](const data_structure::RingBufferSnapshot &snapshot) {
+        cout << "[" << snapshot.first_sample_ << ", " << snapshot.end_sample_
+             << "):";
+        for (size_t j = 0; j < snapshot.acceleration_.get_col_number(); ++j)
+        {
+            for (auto value : snapshot.acceleration_.get_col(j))
+            {
+                cout << " " << value;
+            }
+            cout << ";";
+        }
+        cout << endl;
+    };
+    data_structure::AccelerationRingBuffer small(2, 4, 50);
+
+    // 写入的样本数少于容量时，快照只含已写入的样本
+    small.Push(samples(0, 3, 2));
+    print(small.Snapshot(10)); // [0, 3): 0 100 200; 1 101 201;
+
+    // 跨过存储末尾的快照
+    small.Push(samples(3, 2, 2));
+    print(small.Snapshot(3)); // [2, 5): 200 300 400; 201 301 401;
+
+    // 一次写入超过容量的样本，跳过的样本仍计入样本总数
+    small.Push(samples(5, 6, 2));
+    cout << "write count " << small.get_write_count() << endl; // 11
+    print(small.Snapshot(10)); // [7, 11): 700 800 900 1000; 701 801 901 1001;
+    print(small.SnapshotSeconds(0.04)); // [9, 11): 900 1000; 901 1001;
+
+    // 采集线程连续写入，分析线程同时复制，每次得到的拷贝都必须一致
+    const size_t channel_number = 9, block = 50, total = 30000;
+    data_structure::AccelerationRingBuffer buffer(channel_number, 3000, 50);
+    atomic<bool> finished{false};
+    thread producer([&] {
+        for (size_t k = 0; k < total; k += block)
+        {
+            buffer.Push(samples(k, block, channel_number));
+            this_thread::yield();
+        }
+        finished = true;
+    });
+    size_t inconsistent = 0;
+    while (!finished)
+    {
+        auto snapshot = buffer.SnapshotSeconds(30);
+        for (size_t j = 0; j < channel_number; ++j)
+        {
+            auto col = snapshot.acceleration_.get_col(j);
+            for (size_t i = 0; i < col.size(); ++i)
+            {
+                inconsistent +=
+                    col[i]
+                    != static_cast<double>((snapshot.first_sample_ + i) * 100
+                                           + j);
+            }
+        }
+    }
+    producer.join();
+    auto copy = buffer.CopyLatest(1500);
+    cout << "inconsistent " << inconsistent << ", last value "
+         << copy.get_col(8).back() << endl; // 0, 2.99991e+06
+    return 0;
+}
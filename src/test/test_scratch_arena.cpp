@@ -0,0 +1,93 @@
+﻿#include <iostream>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "numerical_algorithm/butterworth_filter_design.h"
+#include "numerical_algorithm/filter.h"
+#include "numerical_algorithm/scratch_arena.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_scratch_arena()
+{
+    // 初始块1024字节：100个double在初始块内，再分配200个double时向堆申请
+    numerical_algorithm::ScratchArena arena(1024);
+    {
+        numerical_algorithm::ScratchScope scope(arena);
+        auto a = numerical_algorithm::MakeScratchVector(100, 1.0);
+        cout << "in scope: " << (a.get_allocator().resource() == &arena)
+             << ", " << arena.get_allocated() << " bytes, "
+             << arena.get_upstream_count() << " upstream" << endl;
+        // in scope: 1, 800 bytes, 0 upstream
+        auto b = numerical_algorithm::MakeScratchVector(200);
+        cout << "grown: " << arena.get_allocated() << " bytes, "
+             << arena.get_upstream_count() << " upstream" << endl;
+        // grown: 2400 bytes, 1 upstream
+    }
+    // 作用域结束时一次释放，计数清零；下一次事件重新使用初始块
+    cout << "after scope: " << arena.get_allocated() << " bytes, "
+         << arena.get_upstream_count() << " upstream" << endl;
+    // after scope: 0 bytes, 0 upstream
+    {
+        numerical_algorithm::ScratchScope scope(arena);
+        auto a = numerical_algorithm::MakeScratchVector(100);
+        cout << "reused: " << arena.get_upstream_count() << " upstream"
+             << endl; // reused: 0 upstream
+    }
+
+    // 嵌套作用域：内层结束时不释放；内层安装另一个内存池时结束后恢复外层的
+    {
+        numerical_algorithm::ScratchScope outer(arena);
+        auto a = numerical_algorithm::MakeScratchVector(10);
+        {
+            numerical_algorithm::ScratchScope inner(arena);
+            auto b = numerical_algorithm::MakeScratchVector(10);
+        }
+        cout << "nested: " << arena.get_allocated() << " bytes" << endl;
+        // nested: 160 bytes
+        numerical_algorithm::ScratchArena other(0);
+        {
+            numerical_algorithm::ScratchScope inner(other);
+            auto b = numerical_algorithm::MakeScratchVector(10);
+            cout << "other: " << other.get_allocated() << " bytes, "
+                 << other.get_upstream_count() << " upstream" << endl;
+            // other: 80 bytes, 1 upstream
+        }
+        cout << "restored: "
+             << (numerical_algorithm::GetScratchResource() == &arena)
+             << endl; // restored: 1
+
+        // 内存池按线程安装，其他线程仍使用堆内存
+        bool heap = false;
+        thread([&heap] {
+            heap = numerical_algorithm::GetScratchResource()
+                   == std::pmr::new_delete_resource();
+        }).join();
+        cout << "other thread uses heap: " << heap << endl; // 1
+    }
+    cout << "outside scope uses heap: "
+         << (numerical_algorithm::GetScratchResource()
+             == std::pmr::new_delete_resource())
+         << endl; // 1
+
+    // 在作用域中滤波的结果与不使用内存池时相同
+    vector<vector<double>> signal(2, vector<double>(64));
+    for (size_t i = 0; i < 64; ++i)
+    {
+        signal[0][i] = i % 8 < 4 ? 1.0 : -1.0;
+        signal[1][i] = i == 10 ? 1.0 : 0.0;
+    }
+    numerical_algorithm::ButterworthFilterDesign design(4, 0.01, 0.4);
+    numerical_algorithm::Filter filter(
+        design, numerical_algorithm::FilterStructure::second_order_sections);
+    auto reference = filter.Filtering(signal);
+    vector<vector<double>> result;
+    {
+        numerical_algorithm::ScratchScope scope(arena);
+        result = filter.Filtering(signal);
+    }
+    cout << "filter same: " << (result == reference) << endl; // 1
+    return 0;
+}
@@ -0,0 +1,54 @@
+﻿#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "numerical_algorithm/butterworth_filter_design.h"
+#include "numerical_algorithm/filtfilt.h"
+#include "numerical_algorithm/sos_filter.h"
+
+using namespace std;
+
+int test_sos_filter()
+{
+    // 输出二阶节系数
+    auto butter = numerical_algorithm::ButterworthFilterDesign(2, 0.1, 0.2);
+    numerical_algorithm::SosCoefficients sos;
+    butter.get_sos_coefficients(sos);
+    for (const auto &section : sos)
+    {
+        for (auto i : section)
+        {
+            cout << i << " ";
+        }
+        cout << endl;
+    }
+
+    // 低截止频率下传递函数形式与二阶节形式filtfilt结果的相对误差
+    vector<double> input_signal;
+    ifstream input_file("acceleration_data/sig.txt");
+    double temp;
+    while (input_file >> temp)
+    {
+        input_signal.push_back(temp);
+    }
+    input_file.close();
+    for (int order : {2, 3, 4, 6})
+    {
+        numerical_algorithm::ButterworthFilterDesign design(order, 0.002, 0.2);
+        numerical_algorithm::FiltFilt tf_filter(design);
+        numerical_algorithm::FiltFilt sos_filter(
+            design, numerical_algorithm::FilterStructure::second_order_sections);
+        auto tf_output = tf_filter.Filtering(input_signal);
+        auto sos_output = sos_filter.Filtering(input_signal);
+        double error = 0.0, norm = 0.0;
+        for (size_t i = 0; i < sos_output.size(); ++i)
+        {
+            error += (tf_output[i] - sos_output[i])
+                     * (tf_output[i] - sos_output[i]);
+            norm += sos_output[i] * sos_output[i];
+        }
+        cout << "order " << order << ": " << sqrt(error / norm) << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,62 @@
+﻿#include <iostream>
+#include <vector>
+
+#include "data_structure/displacement.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_statistics()
+{
+    // 第0列：相等的极值分别位于第一块和第二块（每块512点），取第一个
+    // 第1列：正负交替，第5点为0，正负绝对值相等的极值取第一个
+    // 第2列：常数列，没有过零
+    vector<vector<double>> matrix(3, vector<double>(1000, 1.0));
+    matrix[0][10] = matrix[0][600] = 9.0;
+    matrix[0][20] = matrix[0][700] = -3.0;
+    for (size_t i = 0; i < matrix[1].size(); ++i)
+    {
+        matrix[1][i] = i % 2 == 0 ? 2.0 : -2.0;
+    }
+    matrix[1][5] = 0.0;
+    matrix[1][3] = -7.0;
+    matrix[1][800] = 7.0;
+    data_structure::Displacement data(matrix, 50);
+
+    auto statistics = data.Statistics();
+    for (const auto &column : statistics)
+    {
+        cout << "max " << column.max_ << " at " << column.max_index_
+             << ", min " << column.min_ << " at " << column.min_index_
+             << ", abs max " << column.abs_max_ << " at "
+             << column.abs_max_index_ << ", energy " << column.energy_
+             << ", mean " << column.mean_ << ", rms " << column.rms_
+             << ", zero crossing " << column.zero_crossing_ << endl;
+    }
+    // max 9 at 10, min -3 at 20, abs max 9 at 10, energy 1176, mean 1.008,
+    // rms 1.08444, zero crossing 4
+    // max 7 at 800, min -7 at 3, abs max -7 at 3, energy 4086, mean 0.002,
+    // rms 2.02139, zero crossing 997
+    // max 1 at 0, min 1 at 0, abs max 1 at 0, energy 1000, mean 1, rms 1,
+    // zero crossing 0
+
+    // 极值及其索引与逐项计算的结果相同，单线程与多线程的结果相同
+    auto positive = data.PositiveMax();
+    auto negative = data.NegativeMax();
+    auto absolute = data.AbsoluteMax();
+    auto single = data.Statistics(1);
+    bool same = true;
+    for (size_t j = 0; j < statistics.size(); ++j)
+    {
+        same = same && statistics[j].max_ == positive[j].first
+               && statistics[j].max_index_ == positive[j].second
+               && statistics[j].min_ == negative[j].first
+               && statistics[j].min_index_ == negative[j].second
+               && statistics[j].abs_max_ == absolute[j].first
+               && statistics[j].abs_max_index_ == absolute[j].second
+               && statistics[j].energy_ == single[j].energy_
+               && statistics[j].zero_crossing_ == single[j].zero_crossing_;
+    }
+    cout << "same as separate: " << same << endl; // 1
+    return 0;
+}
@@ -0,0 +1,75 @@
+﻿#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "numerical_algorithm/butterworth_filter_design.h"
+#include "numerical_algorithm/filter.h"
+#include "numerical_algorithm/streaming_filter.h"
+
+using namespace std;
+
+int test_streaming_filter()
+{
+    vector<double> input_signal;
+    ifstream input_file("acceleration_data/sig.txt");
+    double temp;
+    while (input_file >> temp)
+    {
+        input_signal.push_back(temp);
+    }
+    input_file.close();
+
+    // 分块流式滤波与整段filter滤波的结果对比
+    numerical_algorithm::ButterworthFilterDesign design(2, 0.01, 0.2);
+    for (auto structure :
+         {numerical_algorithm::FilterStructure::transfer_function,
+          numerical_algorithm::FilterStructure::second_order_sections})
+    {
+        numerical_algorithm::Filter filter(design, structure);
+        auto reference = filter.Filtering(
+            vector<vector<double>>(1, input_signal)).front();
+
+        for (size_t block_size : {1, 64, 100, 1000})
+        {
+            numerical_algorithm::StreamingFilter streaming(design, structure);
+            vector<double> block, output, result;
+            for (size_t i = 0; i < input_signal.size(); i += block_size)
+            {
+                auto end = min(i + block_size, input_signal.size());
+                block.assign(input_signal.begin() + i,
+                             input_signal.begin() + end);
+                streaming.Process(block, output);
+                result.insert(result.end(), output.begin(), output.end());
+            }
+            double max_error = 0.0;
+            for (size_t i = 0; i < result.size(); ++i)
+            {
+                max_error = max(max_error, fabs(result[i] - reference[i]));
+            }
+            cout << "structure " << static_cast<int>(structure)
+                 << ", block " << block_size << ": max error " << max_error
+                 << endl;
+        }
+    }
+
+    // 稳态初始条件：带通滤波器直流增益为零，恒定输入时输出无瞬态
+    numerical_algorithm::StreamingFilter streaming(
+        design, numerical_algorithm::FilterStructure::second_order_sections, 2);
+    streaming.ResetSteadyState({1.0, -2.0});
+    vector<double> constant(200), output;
+    for (size_t i = 0; i < constant.size(); i += 2)
+    {
+        constant[i] = 1.0;
+        constant[i + 1] = -2.0;
+    }
+    streaming.Process(constant, output);
+    double max_error = 0.0;
+    for (auto value : output)
+    {
+        max_error = max(max_error, fabs(value));
+    }
+    cout << "steady state: max error " << max_error << endl;
+    return 0;
+}
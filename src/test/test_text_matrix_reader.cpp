@@ -0,0 +1,99 @@
+﻿#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "data_structure/acceleration.h"
+#include "data_structure/text_matrix_reader.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_text_matrix_reader()
+{
+    // 带BOM、CRLF、空行、制表符、正号和指数的小文件，列数由第一行确定
+    const string file_path = "acceleration_data/text_matrix_reader.txt";
+    {
+        ofstream file(file_path, ios::binary);
+        file << "\xEF\xBB\xBF" "1 2 3\r\n\r\n  4\t+5 6e1\r\n-7 .5 9\n   \n";
+    }
+    auto small = data_structure::ReadTextMatrix(file_path);
+    cout << small.get_row_number() << " x " << small.get_col_number() << ":";
+    for (const auto &col : small.to_vector())
+    {
+        for (auto value : col)
+        {
+            cout << " " << value;
+        }
+        cout << ";";
+    }
+    cout << endl; // 3 x 3: 1 4 -7; 2 5 0.5; 3 60 9;
+
+    // 超过64KB的文件按行分块，多线程的结果与单线程相同；第i行第j列为i + j / 4
+    {
+        ofstream file(file_path);
+        file << setprecision(10);
+        for (size_t i = 0; i < 20000; ++i)
+        {
+            file << i << " " << i + 0.25 << " " << i + 0.5 << "\n";
+        }
+    }
+    auto single = data_structure::ReadTextMatrix(file_path, 3, 1);
+    auto multiple = data_structure::ReadTextMatrix(file_path, 0, 4);
+    bool expected = single.get_row_number() == 20000;
+    for (size_t i = 0; expected && i < single.get_row_number(); ++i)
+    {
+        for (size_t j = 0; j < 3; ++j)
+        {
+            expected = expected && single(i, j) == i + j / 4.0
+                       && multiple(i, j) == single(i, j);
+        }
+    }
+    cout << "chunked: " << expected << endl; // 1
+    remove(file_path.c_str());
+
+    // 从CRLF的输入流依次读取两个矩阵，流停在第一个矩阵的最后一个数值之后
+    istringstream crlf("1 2\r\n3 +4\r\n5 6\r\n7 8e0\r\n");
+    data_structure::ColumnMatrix first(2, 2), second(2, 2);
+    data_structure::ReadTextValues(crlf, first);
+    data_structure::ReadTextValues(crlf, second);
+    cout << "crlf: "
+         << (first.to_vector() == vector<vector<double>>{{1, 3}, {2, 4}})
+         << " "
+         << (second.to_vector() == vector<vector<double>>{{5, 7}, {6, 8}})
+         << endl; // 1 1
+
+    // 输入流中数值不足
+    istringstream short_stream("1 2\n3");
+    try
+    {
+        data_structure::ReadTextValues(short_stream, first);
+    }
+    catch (const data_structure::TextParseError &e)
+    {
+        cout << e.what() << endl;
+        // Too few values, expected 4 but found 3. (line 2, column 2)
+    }
+
+    // 解析错误给出行号和列号：无效数值、一行的值过少和过多
+    for (const string text :
+         {"1 2 3\n4 5 6\n7 x 9\n", "1 2 3\n\n4 5\n", "1 2\n3 4 5\n"})
+    {
+        try
+        {
+            data_structure::ParseTextMatrix(text.data(),
+                                            text.data() + text.size());
+        }
+        catch (const data_structure::TextParseError &e)
+        {
+            cout << e.what() << endl;
+        }
+    }
+    // Invalid number. (line 3, column 3)
+    // Too few values in a line, expected 3 but found 2. (line 3, column 4)
+    // Too many values in a line, expected 2. (line 2, column 5)
+    return 0;
+}
@@ -0,0 +1,79 @@
+﻿#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "data_structure/column_matrix.h"
+#include "numerical_algorithm/vector_calculation.h"
+#include "numerical_algorithm/vector_expression.h"
+#include "test_function.h"
+
+using namespace std;
+
+int test_vector_expression()
+{
+    vector<double> a{1, 2, 3, 4}, b{3, 2, 1, 0}, c{2, 4, 8, 16};
+    auto x = numerical_algorithm::MakeVector(a);
+    auto y = numerical_algorithm::MakeVector(b);
+    auto z = numerical_algorithm::MakeVector(c);
+    auto print = [](const vector<double> &values) {
+        for (auto value : values)
+        {
+            cout << value << " ";
+        }
+        cout << endl;
+    };
+
+    // 融合的表达式与逐次调用VectorOperation的结果相同
+    vector<double> result;
+    ((x - y) * 0.5 / z + 1.0).EvaluateTo(result);
+    print(result); // 0.5 1 1.125 1.125
+    auto reference = numerical_algorithm::VectorOperation(
+        numerical_algorithm::VectorOperation(
+            numerical_algorithm::VectorOperation(
+                numerical_algorithm::VectorOperation(a, b, '-'), 0.5, '*'),
+            c,
+            '/'),
+        1.0,
+        '+');
+    cout << "same: " << (result == reference) << endl; // 1
+
+    // 标量为左操作数、取负和取绝对值
+    print((1.0 - x).Evaluate());                          // 0 -1 -2 -3
+    print((12.0 / z).Evaluate());                         // 6 3 1.5 0.75
+    print(numerical_algorithm::Abs(-(y - x)).Evaluate()); // 2 0 2 4
+
+    // 单精度和列视图操作数
+    vector<float> f{0.5f, 0.25f, 0.125f, 0.0f};
+    data_structure::ColumnMatrix matrix(vector<vector<double>>{a, c});
+    auto column = numerical_algorithm::MakeVector(matrix[1]);
+    print((numerical_algorithm::MakeVector(f) * column).Evaluate());
+    // 1 1 1 0
+
+    // 归约：和、内积和绝对值的最大值，空表达式的最大值为0
+    cout << numerical_algorithm::Sum(x) << " "
+         << numerical_algorithm::Dot(x, column) << " "
+         << numerical_algorithm::MaxAbs(y - z) << " "
+         << numerical_algorithm::MaxAbs(
+                numerical_algorithm::MakeVector(vector<double>()))
+         << endl; // 10 98 16 0
+
+    // 结果写回操作数本身
+    auto normalized = a;
+    (numerical_algorithm::MakeVector(normalized)
+     / numerical_algorithm::MaxAbs(x))
+        .EvaluateTo(normalized);
+    print(normalized); // 0.25 0.5 0.75 1
+
+    // 长度不同的操作数
+    try
+    {
+        vector<double> d(3);
+        (x + numerical_algorithm::MakeVector(d)).Evaluate();
+    }
+    catch (const invalid_argument &e)
+    {
+        cout << e.what() << endl;
+        // The operand sizes of a vector expression do not match.
+    }
+    return 0;
+}